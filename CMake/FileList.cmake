@@ -16,7 +16,9 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorTiledInstancer.h
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorTiledVertical.h
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorTiledVerticalInstancer.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/DocumentCache.h
     ${PROJECT_SOURCE_DIR}/Source/Core/DocumentHeader.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/DocumentLoader.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementAnimation.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementBackground.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementBorder.h
@@ -24,6 +26,7 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementDefinition.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementHandle.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementImage.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/ElementPatcher.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementStyle.h
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementTextDefault.h
     ${PROJECT_SOURCE_DIR}/Source/Core/EventDispatcher.h
@@ -37,12 +40,14 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/FontEffectShadow.h
     ${PROJECT_SOURCE_DIR}/Source/Core/GeometryDatabase.h
     ${PROJECT_SOURCE_DIR}/Source/Core/IdNameMap.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/LayoutArena.h
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutBlockBox.h
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutBlockBoxSpace.h
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutEngine.h
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutInlineBox.h
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutInlineBoxText.h
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutLineBox.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/LayoutScheduler.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Memory.h
     ${PROJECT_SOURCE_DIR}/Source/Core/PluginRegistry.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Pool.h
@@ -73,6 +78,7 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/StyleSheetParser.h
     ${PROJECT_SOURCE_DIR}/Source/Core/Template.h
     ${PROJECT_SOURCE_DIR}/Source/Core/TemplateCache.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/TextureAtlas.h
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureDatabase.h
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureLayout.h
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureLayoutRectangle.h
@@ -86,6 +92,7 @@ set(Core_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/XMLNodeHandlerDefault.h
     ${PROJECT_SOURCE_DIR}/Source/Core/XMLNodeHandlerHead.h
     ${PROJECT_SOURCE_DIR}/Source/Core/XMLNodeHandlerTemplate.h
+    ${PROJECT_SOURCE_DIR}/Source/Core/XMLNodeTree.h
     ${PROJECT_SOURCE_DIR}/Source/Core/XMLParseTools.h
 )
 
@@ -95,6 +102,7 @@ set(MASTER_Core_PUB_HDR_FILES
 
 set(Core_PUB_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Animation.h
+    ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/AsyncDocumentLoad.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/BaseXMLParser.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Box.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Colour.h
@@ -107,6 +115,7 @@ set(Core_PUB_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ContextInstancer.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ConvolutionFilter.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Core.h
+    ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/DataModel.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Debug.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Decorator.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/DecoratorInstancer.h
@@ -116,6 +125,7 @@ set(Core_PUB_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ElementDocument.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ElementInstancer.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ElementScroll.h
+    ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ElementSelector.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ElementText.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/ElementUtilities.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Core/Event.h
@@ -182,6 +192,7 @@ set(Core_PUB_HDR_FILES
 )
 
 set(Core_SRC_FILES
+    ${PROJECT_SOURCE_DIR}/Source/Core/AsyncDocumentLoad.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/BaseXMLParser.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Box.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Clock.cpp
@@ -191,6 +202,7 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/ContextInstancerDefault.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ConvolutionFilter.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Core.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/DataModel.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Decorator.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorGradient.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorInstancer.cpp
@@ -205,7 +217,9 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorTiledInstancer.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorTiledVertical.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/DecoratorTiledVerticalInstancer.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/DocumentCache.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/DocumentHeader.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/DocumentLoader.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Element.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementAnimation.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementBackground.cpp
@@ -216,7 +230,9 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementHandle.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementImage.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementInstancer.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/ElementPatcher.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementScroll.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/ElementSelector.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementStyle.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementText.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/ElementTextDefault.cpp
@@ -240,12 +256,14 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/Geometry.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/GeometryDatabase.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/GeometryUtilities.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/LayoutArena.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutBlockBox.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutBlockBoxSpace.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutEngine.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutInlineBox.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutInlineBoxText.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/LayoutLineBox.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/LayoutScheduler.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Log.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Math.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Memory.cpp
@@ -291,6 +309,7 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/Template.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/TemplateCache.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/Texture.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/TextureAtlas.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureDatabase.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureLayout.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/TextureLayoutRectangle.cpp
@@ -313,11 +332,13 @@ set(Core_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Core/XMLNodeHandlerDefault.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/XMLNodeHandlerHead.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/XMLNodeHandlerTemplate.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Core/XMLNodeTree.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/XMLParser.cpp
     ${PROJECT_SOURCE_DIR}/Source/Core/XMLParseTools.cpp
 )
 
 set(Controls_HDR_FILES
+    ${PROJECT_SOURCE_DIR}/Source/Controls/DataSortIndex.h
     ${PROJECT_SOURCE_DIR}/Source/Controls/ElementTextSelection.h
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputType.h
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputTypeButton.h
@@ -326,6 +347,7 @@ set(Controls_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputTypeRange.h
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputTypeSubmit.h
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputTypeText.h
+    ${PROJECT_SOURCE_DIR}/Source/Controls/RowWindow.h
     ${PROJECT_SOURCE_DIR}/Source/Controls/precompiled.h
     ${PROJECT_SOURCE_DIR}/Source/Controls/WidgetDropDown.h
     ${PROJECT_SOURCE_DIR}/Source/Controls/WidgetSlider.h
@@ -361,6 +383,7 @@ set(Controls_PUB_HDR_FILES
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Controls/ElementFormControlTextArea.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Controls/ElementProgressBar.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Controls/ElementTabSet.h
+    ${PROJECT_SOURCE_DIR}/Include/RmlUi/Controls/ElementVirtualList.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Controls/Header.h
     ${PROJECT_SOURCE_DIR}/Include/RmlUi/Controls/SelectOption.h
 )
@@ -369,6 +392,7 @@ set(Controls_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Controls/Controls.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/DataFormatter.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/DataQuery.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Controls/DataSortIndex.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/DataSource.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/DataSourceListener.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/ElementDataGrid.cpp
@@ -383,6 +407,7 @@ set(Controls_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Controls/ElementFormControlTextArea.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/ElementProgressBar.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/ElementTabSet.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Controls/ElementVirtualList.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/ElementTextSelection.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputType.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputTypeButton.cpp
@@ -391,6 +416,7 @@ set(Controls_SRC_FILES
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputTypeRange.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputTypeSubmit.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/InputTypeText.cpp
+    ${PROJECT_SOURCE_DIR}/Source/Controls/RowWindow.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/SelectOption.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/WidgetDropDown.cpp
     ${PROJECT_SOURCE_DIR}/Source/Controls/WidgetSlider.cpp
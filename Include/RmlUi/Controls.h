@@ -44,6 +44,7 @@
 #include "Controls/ElementFormControlTextArea.h"
 #include "Controls/ElementProgressBar.h"
 #include "Controls/ElementTabSet.h"
+#include "Controls/ElementVirtualList.h"
 #include "Controls/SelectOption.h"
 
 #endif
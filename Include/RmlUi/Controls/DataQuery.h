@@ -101,9 +101,9 @@ public:
 	template< typename T >
 	bool GetInto(const size_t field_index, T& value) const
 	{
-		if (field_index < rows[current_row].size())
+		if (field_index < row.size())
 		{
-			return Rml::Core::TypeConverter< Rml::Core::String, T >::Convert(rows[current_row][field_index], value);
+			return Rml::Core::TypeConverter< Rml::Core::String, T >::Convert(row[field_index], value);
 		}
 
 		return false;
@@ -111,7 +111,7 @@ public:
 
 	size_t GetNumFields()
 	{
-		return rows[current_row].size();
+		return row.size();
 	}
 
 private:
@@ -123,8 +123,10 @@ private:
 	int offset;
 	int limit;
 
-	typedef std::vector< Rml::Core::StringList > Rows;
-	Rows rows;    
+	// The fields of the current row.
+	Rml::Core::StringList row;
+	// The table indices of the rows in the query if it is ordered, otherwise empty.
+	std::vector< int > row_indices;
 	typedef Core::UnorderedMap< Rml::Core::String, size_t > FieldIndices;
 	FieldIndices field_indices;
 	
@@ -31,12 +31,14 @@
 
 #include "Header.h"
 #include "../Core/Types.h"
+#include "../Core/StringUtilities.h"
 #include <list>
 
 namespace Rml {
 namespace Controls {
 
 class DataSourceListener;
+class DataSortIndex;
 
 /**
 	Generic object that provides a database-like interface for requesting rows from a table.
@@ -63,6 +65,33 @@ class RMLUICONTROLS_API DataSource
 		/// @return The number of rows within the specified table.
 		virtual int GetNumRows(const Rml::Core::String& table) = 0;
 
+		/// Fetches the values of one column for a range of rows as integers. Used for sorting, so values don't have to
+		/// be converted on every comparison. The default implementation fetches the rows through GetRow() and converts
+		/// the values.
+		/// @param[out] values The list of values, resized to one value per row.
+		/// @param[in] table The name of the table to query.
+		/// @param[in] column The name of the desired column.
+		/// @param[in] first_row The index of the first row to fetch.
+		/// @param[in] num_rows The number of rows to fetch.
+		/// @return True if all the values in the range are integers within the range of an int.
+		virtual bool GetColumnValues(std::vector< int >& values, const Rml::Core::String& table, const Rml::Core::String& column, int first_row, int num_rows);
+		/// Fetches the values of one column for a range of rows as floating-point numbers. The default implementation
+		/// fetches the rows through GetRow() and converts the values. NaN values are sorted as greater than all numbers.
+		/// @return True if all the values in the range are numbers.
+		virtual bool GetColumnValues(std::vector< float >& values, const Rml::Core::String& table, const Rml::Core::String& column, int first_row, int num_rows);
+		/// Fetches the values of one column for a range of rows as views of strings stored by the data source. The
+		/// views must remain valid until the data source next notifies its listeners of a change. The default
+		/// implementation returns false, in which case the values are copied from the rows returned by GetRow().
+		/// @return True if the values could be provided as views.
+		virtual bool GetColumnValues(std::vector< Core::StringView >& values, const Rml::Core::String& table, const Rml::Core::String& column, int first_row, int num_rows);
+
+		/// Returns the indices of a table's rows sorted by the given fields. The ordering is cached and updated as the
+		/// data source notifies its listeners of changes, so rows must not be changed without notifying.
+		/// @param[in] table The name of the table to sort.
+		/// @param[in] order A comma-separated list of the fields to sort by, each optionally followed by 'desc' to sort in descending order.
+		/// @return The row indices in sorted order.
+		const std::vector< int >& GetSortedRows(const Rml::Core::String& table, const Rml::Core::String& order);
+
 		void AttachListener(DataSourceListener* listener);
 		void DetachListener(DataSourceListener* listener);
 
@@ -91,6 +120,13 @@ class RMLUICONTROLS_API DataSource
 		/// @param[in] num_rows_changed The number of rows changed (including the first row).
 		void NotifyRowChange(const Rml::Core::String& table, int first_row_changed, int num_rows_changed);
 
+		/// Tells all attached listeners that some of the columns of one or more rows have been changed in the data source.
+		/// @param[in] table The name of the table to have rows changed in it.
+		/// @param[in] first_row_changed The index of the first row changed.
+		/// @param[in] num_rows_changed The number of rows changed (including the first row).
+		/// @param[in] columns_changed The names of the columns changed in these rows.
+		void NotifyRowChange(const Rml::Core::String& table, int first_row_changed, int num_rows_changed, const Rml::Core::StringList& columns_changed);
+
 		/// Tells all attached listeners that the row structure has completely changed in the data source.
 		/// @param[in] table The name of the table to have rows changed in it.
 		void NotifyRowChange(const Rml::Core::String& table);
@@ -102,6 +138,9 @@ class RMLUICONTROLS_API DataSource
 	private:
 		Core::String name;
 
+		using SortIndexList = std::vector< Core::UniquePtr< DataSortIndex > >;
+		SortIndexList sort_indices;
+
 		using ListenerList = std::list< DataSourceListener* >;
 		ListenerList listeners;
 };
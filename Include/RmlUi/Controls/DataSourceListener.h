@@ -71,6 +71,14 @@ public:
 	/// @param[in] first_row_removed Index of the first changed row.
 	/// @param[in] num_rows_removed Number of new sequential rows being changed.
 	virtual void OnRowChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed);
+	/// Notification of the changing of some of the columns of one or more rows from an observed data source's table.
+	/// By default this is treated as a change of the entire rows, and forwarded to OnRowChange().
+	/// @param[in] data_source Data source being changed.
+	/// @param[in] table The name of the changing table within the data source.
+	/// @param[in] first_row_changed Index of the first changed row.
+	/// @param[in] num_rows_changed Number of new sequential rows being changed.
+	/// @param[in] columns_changed The names of the changed columns.
+	virtual void OnColumnChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed, const Rml::Core::StringList& columns_changed);
 	/// Notification of the change of all of the data of an observed data source's table.
 	/// @param[in] data_source Data source being changed.
 	/// @param[in] table The name of the changing table within the data source.
@@ -38,10 +38,17 @@ namespace Controls {
 
 class DataFormatter;
 class ElementDataGridRow;
+class RowWindow;
 
 /**
 	A table driven from a data source.
 
+	If the 'windowed' attribute is set on the grid, only the rows visible within its client area
+	(plus a number of rows given by the 'overscan' attribute, default 4) are instanced. Rows are
+	recycled as the grid is scrolled, and the scroll height is estimated from the number of rows in
+	the data source and the 'row-height' attribute, or the measured height of the instanced rows if
+	not set. Windowed grids display a flat table, child data sources are not expanded.
+
 	@author Robert Curry
  */
 
@@ -118,13 +125,24 @@ public:
 	int GetNumRows() const;
 	/// Returns the row at the given index in the table.
 	/// @param[in] index The index of the row, relative to the table.
+	/// @return The row, or nullptr if the grid is windowed and the row is not instanced.
 	ElementDataGridRow* GetRow(int index) const;
 
+	/// Returns true if the grid only instances its visible rows.
+	bool IsWindowed() const;
+
 protected:
 	void OnUpdate() override;
 
 	void OnResize() override;
 
+	void OnDataSourceDestroy(DataSource* data_source) override;
+	void OnRowAdd(DataSource* data_source, const Rml::Core::String& table, int first_row_added, int num_rows_added) override;
+	void OnRowRemove(DataSource* data_source, const Rml::Core::String& table, int first_row_removed, int num_rows_removed) override;
+	void OnRowChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed) override;
+	void OnColumnChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed, const Rml::Core::StringList& columns_changed) override;
+	void OnRowChange(DataSource* data_source, const Rml::Core::String& table) override;
+
 	/// Gets the markup and content of the element.
 	/// @param content[out] The content of the element.
 	void GetInnerRML(Rml::Core::String& content) const override;
@@ -148,6 +166,21 @@ private:
 
 	// The block element that contains all our rows. Only used for applying styles.
 	Core::Element* body;
+
+	// Sets the data source of a windowed grid.
+	void SetWindowDataSource(const Rml::Core::String& data_source_name);
+	// Instances, recycles and loads the rows of a windowed grid to cover the current scroll position.
+	// Returns true if any rows were loaded.
+	bool UpdateWindow();
+	// Loads a range of instanced rows of a windowed grid from the data source.
+	void LoadWindowRows(int first_row_to_load, int num_rows_to_load);
+
+	// Windowed mode state, the data source is attached to the grid rather than the root row. The instanced rows are
+	// placed in the body between two spacers taking the place of the remaining rows.
+	Core::UniquePtr< RowWindow > window;
+	DataSource* window_data_source;
+	Rml::Core::String window_data_table;
+	int window_num_rows;
 };
 
 }
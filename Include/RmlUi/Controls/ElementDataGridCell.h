@@ -52,10 +52,19 @@ public:
 
 	void Initialise(int column, Core::Element* header);
 	int GetColumn();
-	
+
+	/// Sets the contents of the cell from the formatted data of its column. If the data is unchanged since the last
+	/// call the cell is left untouched, and if the cell contains only text and the new data is plain text, the
+	/// existing text element is updated in place instead of instancing new elements.
+	/// @param[in] formatted_data The RML to display in the cell.
+	void SetFormattedData(const Rml::Core::String& formatted_data);
+
 private:
 	int column;
 	Core::Element* header;
+
+	// The data the cell contents were last generated from.
+	Rml::Core::String formatted_data;
 };
 
 }
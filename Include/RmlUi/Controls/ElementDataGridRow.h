@@ -95,6 +95,7 @@ protected:
 	void OnRowAdd(DataSource* data_source, const Rml::Core::String& table, int first_row_added, int num_rows_added) override;
 	void OnRowRemove(DataSource* data_source, const Rml::Core::String& table, int first_row_removed, int num_rows_removed) override;
 	void OnRowChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed) override;
+	void OnColumnChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed, const Rml::Core::StringList& columns_changed) override;
 	void OnRowChange(DataSource* data_source, const Rml::Core::String& table) override;
 
 private:
@@ -123,8 +124,9 @@ private:
 	// If the num_rows_removed parameter is left as the -1 default, it'll
 	// default to the rest of the children after the first row.
 	void RemoveChildren(int first_row_removed = 0, int num_rows_removed = -1);
-	// Marks children as dirty and dispatches the event.
-	void ChangeChildren(int first_row_changed = 0, int num_rows_changed = -1);
+	// Marks children as dirty and dispatches the event. If any fields are
+	// given, only the cells of columns using those fields are reloaded.
+	void ChangeChildren(int first_row_changed = 0, int num_rows_changed = -1, const Rml::Core::StringList& changed_fields = Rml::Core::StringList());
 	// Returns the number of rows under this row (children, grandchildren, etc)
 	int GetNumDescendants();
 
@@ -138,10 +140,16 @@ private:
 
 	// Sets the dirty_cells flag on this row, and lets our ancestors know.
 	void DirtyCells();
+	// Sets the dirty_cells flag on this row for the cells of columns using
+	// any of the given fields.
+	void DirtyCells(const Rml::Core::StringList& changed_fields);
 	// Sets the dirty children flag on this row and the row's ancestors.
 	void DirtyRow();
 	// This row has one or more cells that need loading.
 	bool dirty_cells;
+	// The fields changed since the row was last loaded, or empty if all
+	// cells need loading.
+	Rml::Core::StringList dirty_fields;
 	// This row has one or more children that have either dirty flag set.
 	bool dirty_children;
 
@@ -0,0 +1,136 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICONTROLSELEMENTVIRTUALLIST_H
+#define RMLUICONTROLSELEMENTVIRTUALLIST_H
+
+#include "Header.h"
+#include "DataSourceListener.h"
+#include "../Core/Element.h"
+
+namespace Rml {
+namespace Controls {
+
+class DataFormatter;
+class RowWindow;
+
+/**
+	The 'virtuallist' element, a scrolling list driven from a data source which only instances
+	elements for the rows that are currently visible.
+
+	The 'source' attribute names the data source and table in 'source.table' format, and the
+	'fields' attribute lists the fields requested for each row. The contents of the element are
+	used as a template for each row, where occurrences of {{field}} are replaced by the row's value
+	of the named field, encoded to be shown as text. As these use the syntax of data bindings, the
+	contents of the list are never bound to a data model. If a 'formatter' attribute is set, the
+	data formatter is used to generate the row contents instead. Rows are instanced as 'listrow'
+	elements with an 'index' attribute.
+
+	Only rows intersecting the element's client area, plus a number of rows given by the 'overscan'
+	attribute (default 4) on each side, are instanced. Row elements are recycled as the list is
+	scrolled. The total scroll height is estimated from the 'row-height' attribute if set, otherwise
+	from the measured height of the instanced rows.
+
+	The element should be given a fixed height and 'overflow-y: auto' or 'scroll'.
+ */
+
+class RMLUICONTROLS_API ElementVirtualList : public Core::Element, public DataSourceListener
+{
+public:
+	/// Constructs a new ElementVirtualList. This should not be called directly; use the Factory
+	/// instead.
+	/// @param[in] tag The tag the element was declared as in RML.
+	ElementVirtualList(const Rml::Core::String& tag);
+	virtual ~ElementVirtualList();
+
+	/// Sets the data source the list's rows are driven from.
+	/// @param[in] data_source The name of the new data source, in 'source.table' format.
+	void SetDataSource(const Rml::Core::String& data_source);
+	/// Sets the RML template used to generate each row, replacing any template given in the document.
+	/// @param[in] rml The row template, where {{field}} is replaced by the row's value of the named field, encoded as text.
+	void SetRowTemplate(const Rml::Core::String& rml);
+
+	/// Returns the number of rows in the list.
+	int GetNumRows() const;
+	/// Returns the element of one of the list's rows, if it is currently instanced.
+	/// @param[in] index The index of the row.
+	/// @return The row element, or nullptr if the row is not instanced.
+	Core::Element* GetRow(int index) const;
+	/// Returns the number of rows currently instanced as elements.
+	int GetNumInstancedRows() const;
+
+	/// Scrolls the list so that the given row is at the top of the client area.
+	/// @param[in] index The index of the row to scroll to.
+	void ScrollToRow(int index);
+
+protected:
+	/// Attaches to the data source if necessary, and instances the rows visible at the current
+	/// scroll position.
+	void OnUpdate() override;
+
+	/// Checks for changes to the data source or formatting attributes.
+	/// @param[in] changed_attributes List of changed attributes on the element.
+	void OnAttributeChange(const Core::ElementAttributes& changed_attributes) override;
+
+	/// Detaches from the data source and clears the rows.
+	void OnDataSourceDestroy(DataSource* data_source) override;
+	/// Refreshes the instanced rows.
+	void OnRowAdd(DataSource* data_source, const Rml::Core::String& table, int first_row_added, int num_rows_added) override;
+	/// Refreshes the instanced rows.
+	void OnRowRemove(DataSource* data_source, const Rml::Core::String& table, int first_row_removed, int num_rows_removed) override;
+	/// Refreshes any instanced rows within the changed range.
+	void OnRowChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed) override;
+	/// Refreshes the instanced rows.
+	void OnRowChange(DataSource* data_source, const Rml::Core::String& table) override;
+
+private:
+	// Instances, recycles and formats rows to cover the current scroll position.
+	void UpdateRows();
+	// Generates the contents of a row element from the data source.
+	void FormatRow(Core::Element* row, int index);
+	// Parses the formatting attributes.
+	void ParseAttributes();
+
+	DataSource* data_source;
+	Rml::Core::String data_table;
+
+	Rml::Core::StringList fields;
+	Rml::Core::String row_template;
+	DataFormatter* data_formatter;
+
+	// The instanced rows, placed between two spacers taking the place of the remaining rows.
+	Core::UniquePtr< RowWindow > window;
+	int num_rows;
+
+	bool initialised;
+};
+
+}
+}
+
+#endif
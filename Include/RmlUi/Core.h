@@ -35,16 +35,19 @@
 #include "Core/Math.h"
 #include "Core/Header.h"
 #include "Core/Animation.h"
+#include "Core/AsyncDocumentLoad.h"
 #include "Core/Box.h"
 #include "Core/ComputedValues.h"
 #include "Core/Context.h"
 #include "Core/ContextInstancer.h"
+#include "Core/DataModel.h"
 #include "Core/Decorator.h"
 #include "Core/DecoratorInstancer.h"
 #include "Core/Element.h"
 #include "Core/ElementDocument.h"
 #include "Core/ElementInstancer.h"
 #include "Core/ElementScroll.h"
+#include "Core/ElementSelector.h"
 #include "Core/ElementText.h"
 #include "Core/ElementUtilities.h"
 #include "Core/Event.h"
@@ -0,0 +1,92 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREASYNCDOCUMENTLOAD_H
+#define RMLUICOREASYNCDOCUMENTLOAD_H
+
+#include "Header.h"
+#include "Traits.h"
+#include "Types.h"
+#include <atomic>
+#include <functional>
+
+namespace Rml {
+namespace Core {
+
+class Context;
+class ElementDocument;
+class StyleSheet;
+class XMLNodeTree;
+
+/// Called on the main thread once a document loaded in the background has been added to its context, or with nullptr
+/// if the document could not be loaded.
+using AsyncDocumentCallback = std::function<void(ElementDocument* document)>;
+
+/**
+	A handle to a document being loaded in the background through Context::LoadDocumentAsync(). The document file is
+	read and parsed on the loader thread, together with the style sheets linked or embedded in its header. The document
+	is then instanced and added to the context during the next context update after preparation has finished.
+
+	@author The RmlUi Team
+ */
+
+class RMLUICORE_API AsyncDocumentLoad : public NonCopyMoveable
+{
+public:
+	AsyncDocumentLoad(const String& document_path, AsyncDocumentCallback callback);
+	~AsyncDocumentLoad();
+
+	/// Returns the path of the document being loaded.
+	const String& GetPath() const;
+
+	/// Returns true once the document has been added to its context, or loading has failed.
+	bool IsComplete() const;
+	/// Returns the loaded document.
+	/// @return The document, or nullptr if loading has not completed yet or failed.
+	ElementDocument* GetDocument() const;
+
+private:
+	String path;
+	AsyncDocumentCallback callback;
+
+	// Set by the loader thread, and read by the main thread once the load is prepared.
+	SharedPtr<const XMLNodeTree> node_tree;
+	SharedPtr<StyleSheet> style_sheet;
+	std::atomic<bool> prepared;
+
+	bool complete;
+	ElementDocument* document;
+
+	friend class Context;
+	friend class DocumentLoader;
+};
+
+}
+}
+
+#endif
@@ -112,6 +112,8 @@ class RMLUICORE_API BaseXMLParser
 		String data;
 
 		SmallUnorderedSet< String > cdata_tags;
+
+		friend class XMLNodeTree;
 };
 
 }
@@ -30,6 +30,8 @@
 #define RMLUICORECONTEXT_H
 
 #include "Header.h"
+#include "AsyncDocumentLoad.h"
+#include "DataModel.h"
 #include "Types.h"
 #include "Traits.h"
 #include "Input.h"
@@ -101,6 +103,15 @@ public:
 	/// @param[in] string The string containing the document RML.
 	/// @return The loaded document, or nullptr if no document was loaded.
 	ElementDocument* LoadDocumentFromMemory(const String& string);
+	/// Load a document into the context in the background. The file is read and parsed, and the style sheets of its
+	/// header are built, on a loader thread. The document is then instanced and added to the context during the first
+	/// call to Update() after it has been prepared, dispatching the 'load' event as usual.
+	/// @param[in] document_path The path to the document to load.
+	/// @param[in] callback Optional function called when the document has been added, or with nullptr if loading failed.
+	/// @return A handle to query the state of the load.
+	/// @note The file interface, the system interface's logging and path functions, and any custom decorator instancers
+	/// are then also called from the loader thread.
+	SharedPtr<AsyncDocumentLoad> LoadDocumentAsync(const String& document_path, AsyncDocumentCallback callback = nullptr);
 	/// Unload the given document.
 	/// @param[in] document The document to unload.
 	void UnloadDocument(ElementDocument* document);
@@ -123,6 +134,18 @@ public:
 	/// Returns the number of documents in the context.
 	int GetNumDocuments() const;
 
+	/// Creates a data model for binding application values to the elements of this context's documents, see DataModel.
+	/// The model must be created before the documents binding to it are loaded.
+	/// @param[in] name The name of the model, referred to by the 'data-model' attribute of elements.
+	/// @return The new model, or nullptr if a model with the name already exists.
+	DataModel* CreateDataModel(const String& name);
+	/// Returns the data model with the given name.
+	/// @return The model, or nullptr if no model exists with the name.
+	DataModel* GetDataModel(const String& name);
+	/// Removes the data model with the given name. Elements bound to the model keep their current values.
+	/// @return True if the model was removed, false if no model exists with the name.
+	bool RemoveDataModel(const String& name);
+
 	/// Returns the hover element.
 	/// @return The element the mouse cursor is hovering over.
 	Element* GetHoverElement();
@@ -240,6 +263,11 @@ private:
 	// Documents that have been unloaded from the context but not yet released.
 	OwnedElementList unloaded_documents;
 
+	// Documents being loaded in the background, in the order they were requested.
+	std::vector< SharedPtr<AsyncDocumentLoad> > pending_document_loads;
+
+	UnorderedMap< String, UniquePtr<DataModel> > data_models;
+
 	// Root of the element tree.
 	ElementPtr root;
 	// The element that current has input focus.
@@ -286,6 +314,11 @@ private:
 	Vector2i clip_origin;
 	Vector2i clip_dimensions;
 
+	// Attaches a newly instanced document to the context and fires its load events.
+	ElementDocument* AddLoadedDocument(ElementPtr element);
+	// Instances and adds the documents of background loads which have been prepared.
+	void CompleteDocumentLoads();
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
 	// Internal callback for when a new element gains focus.
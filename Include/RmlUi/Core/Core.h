@@ -43,9 +43,28 @@ class FileInterface;
 class FontEngineInterface;
 class RenderInterface;
 class SystemInterface;
+struct TextureMemoryStatistics;
 enum class DefaultActionPhase;
 
 
+/**
+	Statistics of the memory allocated by the layout engine, accumulated over all layout passes. The boxes and
+	containers of a layout pass are placed in an arena which is reused by the next pass.
+ */
+
+struct LayoutMemoryStatistics
+{
+	// The number of layout passes, not counting passes nested inside another one.
+	int num_passes = 0;
+	// The number of boxes and container buffers allocated from the arena.
+	int num_allocations = 0;
+	// The number of times the arena had to allocate memory from the heap.
+	int num_heap_allocations = 0;
+	// The number of bytes currently reserved by the arena.
+	size_t arena_size = 0;
+};
+
+
 /**
 	RmlUi library core API.
 
@@ -144,8 +163,36 @@ RMLUICORE_API EventId RegisterEventType(const String& type, bool interruptible,
 
 /// Forces all texture handles loaded and generated by RmlUi to be released.
 RMLUICORE_API void ReleaseTextures();
+/// Sets a budget for the memory used by textures loaded from file. When the budget is exceeded, textures no longer in use
+/// are released in least-recently-used order. Released textures are transparently reloaded if they are used again.
+/// @param[in] budget_bytes The texture memory budget in bytes, or zero to disable the budget.
+/// @note This must be called after Initialise().
+RMLUICORE_API void SetTextureMemoryBudget(size_t budget_bytes);
+/// Returns statistics of the memory used by textures, including the number of evicted and reloaded textures.
+RMLUICORE_API TextureMemoryStatistics GetTextureMemoryStatistics();
+/// Enables packing of small images into shared texture atlas pages at runtime, so that elements and decorators using
+/// different images can be rendered using the same texture. Requires the render interface to implement LoadTextureData().
+/// Only affects textures loaded after the call. Atlas pages are updated with newly loaded images in Context::Update().
+/// Images keep their place in the atlas through ReleaseTextures().
+/// @param[in] max_image_dimensions Images with both width and height at most this size are packed into the atlas. Set to zero to disable atlasing.
+/// @param[in] page_dimensions The width and height of each atlas page.
+/// @note This must be called after Initialise().
+RMLUICORE_API void SetTextureAtlas(int max_image_dimensions, int page_dimensions = 1024);
 /// Forces all compiled geometry handles generated by RmlUi to be released.
 RMLUICORE_API void ReleaseCompiledGeometry();
+/// Returns the number of times block formatting has been restarted because the vertical scrollbar of an element with
+/// 'overflow-y: auto' appeared during layout. Useful for profiling layout performance.
+RMLUICORE_API int GetNumLayoutRestarts();
+/// Returns statistics of the memory allocated during layout, including the number of heap allocations.
+RMLUICORE_API LayoutMemoryStatistics GetLayoutMemoryStatistics();
+/// Enables parallel layout, where the documents of a context needing layout are formatted concurrently on a pool of
+/// worker threads during Context::Update(). Element callbacks invoked during layout, such as OnLayout() and OnResize(),
+/// are serialised and must only modify their own document. Images loaded during layout may call the render
+/// interface's LoadTexture() from a worker thread. A custom font engine must support concurrent calls to
+/// GetStringWidth().
+/// @param[in] num_threads The number of worker threads, or zero to disable parallel layout.
+/// @note This must be called after Initialise().
+RMLUICORE_API void SetLayoutThreads(int num_threads);
 
 }
 }
@@ -0,0 +1,175 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREDATAMODEL_H
+#define RMLUICOREDATAMODEL_H
+
+#include "Header.h"
+#include "ObserverPtr.h"
+#include "Traits.h"
+#include "Types.h"
+#include "Variant.h"
+#include <functional>
+
+namespace Rml {
+namespace Core {
+
+class Context;
+class Element;
+class ElementText;
+
+/// Retrieves the current value of a data variable.
+using DataGetFunc = std::function<void(Variant& value)>;
+
+/**
+	A data model binds named variables of the application to the elements of a context's documents. Inside an element
+	with the attribute 'data-model' set to the name of the model, any '{{name}}' in text is replaced by the value of the
+	named variable, and an attribute 'data-attr-<attribute>' set to a variable name, or to text referencing variables,
+	sets the given attribute to the resulting value.
+
+	Bindings are made as elements are instanced from RML within a document of the context, thus not for elements
+	created through Element::Clone() or ElementDocument::CreateElement(). Nothing is bound within elements whose tag
+	is registered with RegisterTemplateTag(), such as the 'virtuallist' element of the controls plugin, as they use the
+	same syntax to fill in their own templates. During each context update, the text and
+	attributes bound to variables marked dirty are evaluated again, and only those whose value changed are set on their
+	elements, without parsing any RML.
+
+	@author The RmlUi Team
+ */
+
+class RMLUICORE_API DataModel : public NonCopyMoveable
+{
+public:
+	DataModel(const String& name);
+	~DataModel();
+
+	/// Returns the name of the model.
+	const String& GetName() const;
+
+	/// Binds a variable to a value owned by the application, which is read whenever the variable's bindings are updated.
+	/// @param[in] name The name of the variable.
+	/// @param[in] value The value, of any type storable in a Variant. It must be kept alive for as long as the model.
+	/// @return True if the variable was bound, false if a variable with the name has already been bound.
+	template< typename T >
+	bool Bind(const String& name, const T* value)
+	{
+		return BindGetter(name, [value](Variant& variant) { variant = *value; });
+	}
+	/// Binds a variable to a function retrieving its value whenever the variable's bindings are updated.
+	/// @param[in] name The name of the variable.
+	/// @param[in] getter The function retrieving the value.
+	/// @return True if the variable was bound, false if a variable with the name has already been bound.
+	bool BindGetter(const String& name, DataGetFunc getter);
+
+	/// Marks a variable as changed, so that its bindings are updated during the next context update.
+	/// @param[in] name The name of the variable.
+	void DirtyVariable(const String& name);
+	/// Marks all variables as changed.
+	void DirtyAllVariables();
+	/// Returns true if the variable has been marked as changed since the last update.
+	bool IsVariableDirty(const String& name) const;
+
+	/// Registers the tag of elements whose contents are templates filled in by the elements themselves. Text and
+	/// attributes within these elements, including the content they generate, are never bound to a data model.
+	/// @param[in] tag The tag of the elements.
+	static void RegisterTemplateTag(const String& tag);
+
+private:
+	struct Variable
+	{
+		DataGetFunc getter;
+		bool dirty = false;
+		// The bindings using this variable.
+		std::vector< int > bindings;
+	};
+
+	// Text between variable references, or a reference to a variable.
+	struct Segment
+	{
+		String text;
+		int variable;
+	};
+
+	struct Binding
+	{
+		ObserverPtr<Element> element;
+		// The bound attribute, or empty for the text of a text element.
+		String attribute;
+		std::vector< Segment > segments;
+		// The value last set on the element.
+		String value;
+		int update_generation = 0;
+		bool active = false;
+	};
+
+	// Returns the model named by the 'data-model' attribute of an element being instanced into the given parent, or of
+	// its nearest ancestor with one, if any.
+	static DataModel* GetModelInScope(Element* parent, Element* element = nullptr);
+	// Binds the text of a text element being instanced into the given parent, if the text references any variables.
+	static void BindText(Element* parent, ElementText* text_element, const String& text);
+	// Binds the 'data-attr-' attributes of an element being instanced into the given parent.
+	static void BindAttributes(Element* parent, Element* element);
+	// Binds the attributes and text of an element and its descendants, which were instanced outside of any document.
+	static void BindElementTree(Element* element);
+
+	// Returns the index of the named variable, adding it if it hasn't been referenced or bound before.
+	int GetVariableIndex(const String& name);
+	// Splits text into segments, returns false if it references no variables.
+	bool ParseSegments(const String& text, std::vector< Segment >& segments);
+
+	// Binds the text or the attribute of the element, given its current value.
+	void AddBinding(Element* element, const String& attribute, const String& current_value, std::vector< Segment >&& segments);
+	void RemoveBinding(int index);
+	// Removes the bindings of destroyed elements.
+	void SweepBindings();
+	// Sets the current value of the binding on its element if it changed, returns false if the element is gone.
+	bool UpdateBinding(int index);
+
+	// Updates the bindings of the dirty variables, called during the context update.
+	void Update();
+
+	String name;
+
+	std::vector< Variable > variables;
+	UnorderedMap< String, int > variable_indices;
+	bool variables_dirty;
+
+	std::vector< Binding > bindings;
+	std::vector< int > free_bindings;
+	size_t sweep_size;
+	int update_generation;
+
+	friend class Context;
+	friend class ElementPatcher;
+	friend class Factory;
+};
+
+}
+}
+
+#endif
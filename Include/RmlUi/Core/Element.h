@@ -54,6 +54,7 @@ class ElementDecoration;
 class ElementDefinition;
 class ElementDocument;
 class ElementScroll;
+class ElementSelector;
 class ElementStyle;
 class PropertiesIteratorView;
 class FontFaceHandleDefault;
@@ -62,6 +63,7 @@ class RenderInterface;
 class TransformState;
 class StyleSheet;
 struct ElementMeta;
+struct ElementBatch;
 
 /**
 	A generic element in the DOM tree.
@@ -79,7 +81,9 @@ public:
 	Element(const String& tag);
 	virtual ~Element();
 
-	/// Clones this element, returning a new, unparented element.
+	/// Clones this element and its children, returning a new, unparented element. Along with the attributes, the classes
+	/// and inline properties of each element are copied. Children which the instancer creates along with the element are
+	/// not copied, the clone has its own.
 	ElementPtr Clone() const;
 
 	/** @name Classes
@@ -449,6 +453,11 @@ public:
 	/// Sets the markup and content of the element. All existing children will be replaced.
 	/// @param[in] rml The new content of the element.
 	void SetInnerRML(const String& rml);
+	/// Sets the markup and content of the element by patching the existing children. Children matching the new markup
+	/// by tag, id and 'key' attribute are kept and only their differences applied, which avoids restyling and laying out
+	/// content that hasn't changed. Event listeners and state of the kept children are retained.
+	/// @param[in] rml The new content of the element.
+	void PatchInnerRML(const String& rml);
 
 	//@}
 
@@ -513,6 +522,13 @@ public:
 	/// Returns whether or not this element has any DOM children.
 	/// @return True if the element has at least one DOM child, false otherwise.
 	bool HasChildNodes() const;
+	/// Begins a batch of changes to the children of this element. Until the batch ends, appending, inserting, replacing
+	/// and removing children of this element defers the invalidation of its stacking context and layout, as well as the
+	/// OnChildAdd() notifications of the added children. Batches may be nested.
+	void BeginBatch();
+	/// Ends a batch of changes begun with BeginBatch(). When the outermost batch ends, the deferred notifications are
+	/// sent in the order the children were added, and the element is invalidated once for all the changes.
+	void EndBatch();
 
 	/// Get a child element by its ID.
 	/// @param[in] id Id of the the child element
@@ -526,6 +542,22 @@ public:
 	/// @param[out] elements Resulting elements.
 	/// @param[in] tag Tag to search for.
 	void GetElementsByClassName(ElementList& elements, const String& class_name);
+	/// Get the first descendant element matching the given RCSS selector, in document order.
+	/// @param[in] selector The selector, or a comma-separated list of selectors, such as "div.panel > button".
+	/// @return The first matching element, or nullptr if none was found.
+	Element* QuerySelector(const String& selector);
+	/// Get the first descendant element matching the given compiled selector, in document order.
+	/// @param[in] selector The compiled selector, which can be reused across calls.
+	/// @return The first matching element, or nullptr if none was found.
+	Element* QuerySelector(const ElementSelector& selector);
+	/// Get all descendant elements matching the given RCSS selector, in document order.
+	/// @param[out] elements Resulting elements.
+	/// @param[in] selector The selector, or a comma-separated list of selectors, such as "div.panel > button".
+	void QuerySelectorAll(ElementList& elements, const String& selector);
+	/// Get all descendant elements matching the given compiled selector, in document order.
+	/// @param[out] elements Resulting elements.
+	/// @param[in] selector The compiled selector, which can be reused across calls.
+	void QuerySelectorAll(ElementList& elements, const ElementSelector& selector);
 	//@}
 
 	/**
@@ -626,6 +658,26 @@ private:
 	void DirtyOffset();
 	void UpdateOffset();
 
+	Vector2f GetUnscrolledOffset(Box::Area area);
+	Vector2f GetScrollTranslation();
+	static void DirtyScrollTranslation();
+
+	// Called before formatting the element for a layout result to cache, returns the stamp to cache the result with. Any
+	// layout change to this element or its descendants from here on invalidates the result, including changes during
+	// the formatting.
+	unsigned int BeginLayoutMeasurement();
+
+	// Returns the shrink-to-fit width measured for the given containing block, if it is still valid.
+	bool GetCachedShrinkToFitWidth(float& width, const Vector2f& containing_block) const;
+	// Caches the shrink-to-fit width measured for the given containing block.
+	void SetCachedShrinkToFitWidth(float width, const Vector2f& containing_block, unsigned int stamp);
+
+	// Returns true if the content was found to overflow the given content width and overflow height without a vertical
+	// scrollbar, and the result is still valid.
+	bool GetCachedVerticalOverflow(const Vector2f& overflow_box) const;
+	// Caches that the content overflows the given content width and overflow height without a vertical scrollbar.
+	void SetCachedVerticalOverflow(const Vector2f& overflow_box, unsigned int stamp);
+
 	void BuildLocalStackingContext();
 	void BuildStackingContext(ElementList* stacking_context);
 	void DirtyStackingContext();
@@ -633,6 +685,11 @@ private:
 	void DirtyStructure();
 	void UpdateStructure();
 
+	// Invalidates the element after its children have changed, or records the invalidation while a batch is open.
+	void DirtyChildren(bool dom_children);
+	// Notifies the element and its ancestors of the added child, or records the notification while a batch is open.
+	void ChildAdded(Element* child);
+
 	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
 	void UpdateTransformState();
 
@@ -661,6 +718,20 @@ private:
 
 	// The optional, unique ID of this object.
 	String id;
+	// True if we are listed under our id in the id index of our owner document.
+	bool id_indexed;
+	// True if we are listed under our tag and classes in the indexes of our owner document.
+	bool dom_indexed;
+
+	// Our position in the DOM of our owner document, valid while 'dom_order_generation' matches the document's. The
+	// DOM descendants of this element are numbered in the range (dom_order_begin, dom_order_end].
+	int dom_order_generation;
+	int dom_order_begin;
+	int dom_order_end;
+	int dom_depth;
+
+	// A hash of the RML this element was created from when instanced by PatchInnerRML(), or zero.
+	size_t patch_fingerprint;
 
 	// Instancer that created us, used for destruction.
 	ElementInstancer* instancer;
@@ -681,9 +752,25 @@ private:
 	Vector2f relative_offset_position;	// the offset of a relatively positioned element
 	bool offset_fixed;
 
+	// The offset of the element from the root, excluding the scroll offset of its ancestors.
 	mutable Vector2f absolute_offset;
 	mutable bool offset_dirty;
 
+	// The scroll offset of the element's ancestors, cached until any element scrolls or is offset.
+	Vector2f scroll_translation;
+	unsigned int scroll_translation_generation;
+
+	// Stamp of the last layout change to this element or any of its descendants.
+	unsigned int layout_change_stamp;
+	// The shrink-to-fit width of the element's content, and the layout change stamp and containing block it was measured with.
+	float shrink_to_fit_width;
+	unsigned int shrink_to_fit_stamp;
+	Vector2f shrink_to_fit_containing_block;
+	// The content width and overflow height the element's content was last found to overflow at without a vertical
+	// scrollbar, and the layout change stamp it was formatted with.
+	Vector2f vertical_overflow_box;
+	unsigned int vertical_overflow_stamp;
+
 	// The offset this element adds to its logical children due to scrolling content.
 	Vector2f scroll_offset;
 
@@ -714,6 +801,11 @@ private:
 
 	bool structure_dirty;
 
+	// The state of the open batch of changes to our children, only allocated while a batch is open.
+	UniquePtr< ElementBatch > batch;
+	// The index of this element in its parent's list of added children pending notification, or -1 if not pending.
+	int batch_added_index;
+
 	bool computed_values_are_default_initialized;
 
 	// Cached rendering information
@@ -733,8 +825,11 @@ private:
 	ElementMeta* meta;
 
 	friend class Context;
+	friend class ElementDocument;
+	friend class ElementPatcher;
 	friend class ElementStyle;
 	friend class LayoutEngine;
+	friend class LayoutBlockBox;
 	friend class LayoutInlineBox;
 	friend struct ElementDeleter;
 	friend class ElementScroll;
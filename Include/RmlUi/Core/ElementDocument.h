@@ -157,6 +157,44 @@ private:
 	/// Sets the dirty flag for document positioning
 	void DirtyPosition();
 
+	/// Adds an element with a non-empty id to the id index of this document.
+	void AddToIdIndex(Element* element);
+	/// Removes an element from the id index of this document.
+	void RemoveFromIdIndex(Element* element);
+	/// Returns the elements of this document with the given id, in no particular order, or nullptr if there are none.
+	const ElementList* GetIndexedElementsById(const String& id) const;
+
+	/// Adds an element to the tag and class indexes of this document.
+	void AddToDomIndex(Element* element);
+	/// Removes an element from the tag and class indexes of this document.
+	void RemoveFromDomIndex(Element* element);
+	/// Adds a single class of an element to the class index of this document.
+	void AddToClassIndex(Element* element, const String& class_name);
+	/// Removes a single class of an element from the class index of this document.
+	void RemoveFromClassIndex(Element* element, const String& class_name);
+	/// Appends the DOM descendants of an element with the given tag, in breadth first order, using the tag index.
+	/// @return False if the index can't be used for the root element, or if searching below it is expected to be faster.
+	bool GetIndexedDescendantsByTag(ElementList& elements, Element* root_element, const String& tag);
+	/// Appends the DOM descendants of an element with the given class, in breadth first order, using the class index.
+	/// @return False if the index can't be used for the root element, or if searching below it is expected to be faster.
+	bool GetIndexedDescendantsByClass(ElementList& elements, Element* root_element, const String& class_name);
+	/// Appends the DOM descendants of an element which have the id, class or tag required by a selector, in document
+	/// order, using the id, class or tag index in that order of preference. The candidates must still be matched
+	/// against the selector.
+	/// @return False if the selector requires none of these, or if the indexes can't or shouldn't be used as above.
+	bool GetIndexedSelectorCandidates(ElementList& elements, Element* root_element, const ElementSelector& selector);
+	/// Appends the indexed elements which are DOM descendants of the root element, in breadth first order or in
+	/// document order.
+	bool GetIndexedDescendants(ElementList& elements, Element* root_element, const UnorderedSet< Element* >* indexed_elements, bool document_order = false);
+
+	/// Marks the DOM order numbering of the elements in this document as out of date.
+	void DirtyDomOrder();
+	/// Numbers the elements of this document in DOM order if it has changed, so that indexed elements can be tested for
+	/// being a descendant of another element, and sorted.
+	void UpdateDomOrder();
+	/// Numbers the element and its DOM descendants in document order, starting from the given counter.
+	static void AssignDomOrder(Element* element, int depth, int generation, int& counter);
+
 	// Title of the document
 	String title;
 
@@ -176,8 +214,22 @@ private:
 
 	bool position_dirty;
 
+	// The elements of this document with an id, looked up by their id. Kept up to date as elements change their id or
+	// are attached to and detached from the document.
+	UnorderedMap< String, ElementList > id_index;
+	// The elements of this document by their tag and by each of their classes.
+	UnorderedMap< String, UnorderedSet< Element* > > tag_index;
+	UnorderedMap< String, UnorderedSet< Element* > > class_index;
+
+	// True if the elements need to be numbered again before their DOM order can be used.
+	bool dom_order_dirty;
+	int dom_order_generation;
+
 	friend class Context;
+	friend class Element;
+	friend class ElementUtilities;
 	friend class Factory;
+	friend class LayoutScheduler;
 
 };
 
@@ -0,0 +1,98 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREELEMENTSELECTOR_H
+#define RMLUICOREELEMENTSELECTOR_H
+
+#include "Header.h"
+#include "Types.h"
+
+namespace Rml {
+namespace Core {
+
+class Element;
+class StyleSheetNode;
+
+/**
+	A selector compiled once from its RCSS form, such as "div.panel > button:hover, #title", for matching against
+	elements any number of times. Selectors are parsed by the same rules as style sheets, and matched from the right-most
+	node out to the ancestors.
+
+	@author The RmlUi Team
+ */
+
+class RMLUICORE_API ElementSelector
+{
+public:
+	ElementSelector();
+	/// Constructs and compiles a selector.
+	/// @param[in] selector The selector, or a comma-separated list of selectors.
+	explicit ElementSelector(const String& selector);
+	ElementSelector(const ElementSelector& other);
+	ElementSelector(ElementSelector&& other) noexcept;
+	ElementSelector& operator=(const ElementSelector& other);
+	ElementSelector& operator=(ElementSelector&& other) noexcept;
+	~ElementSelector();
+
+	/// Compiles a new selector, replacing any previous one.
+	/// @param[in] selector The selector, or a comma-separated list of selectors.
+	/// @return True if at least one selector was compiled.
+	bool Compile(const String& selector);
+	/// Returns true if the selector holds at least one compiled selector.
+	bool IsValid() const;
+	/// Returns the selector in the form it was compiled from.
+	const String& GetSource() const;
+
+	/// Returns true if the element matches any of the compiled selectors.
+	/// @param[in] element The element to test.
+	bool Matches(const Element* element) const;
+
+	/// Returns the id every matching element must have, or an empty string if the selector doesn't require a single id.
+	const String& GetRequiredId() const;
+	/// Returns a class every matching element must have, or an empty string if the selector doesn't require one.
+	const String& GetRequiredClass() const;
+	/// Returns the tag every matching element must have, or an empty string if the selector doesn't require a single tag.
+	const String& GetRequiredTag() const;
+
+private:
+	String source;
+
+	// The root of the compiled selector nodes, and the leaf node of each comma-separated selector.
+	UniquePtr<StyleSheetNode> root;
+	std::vector< const StyleSheetNode* > leaf_nodes;
+
+	// Requirements shared by every compiled selector, used to look up candidate elements in the document's indexes.
+	String required_id;
+	String required_class;
+	String required_tag;
+};
+
+}
+}
+
+#endif
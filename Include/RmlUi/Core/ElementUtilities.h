@@ -37,6 +37,7 @@ namespace Core {
 
 class Box;
 class Context;
+class ElementSelector;
 class RenderInterface;
 namespace Style { struct ComputedValues; }
 
@@ -76,6 +77,16 @@ public:
 	/// @param[in] root_element First element to check.
 	/// @param[in] tag Class name to search for.
 	static void GetElementsByClassName(ElementList& elements, Element* root_element, const String& class_name);
+	/// Get the first descendant element matching the given selector, in document order.
+	/// @param[in] root_element The element to search below.
+	/// @param[in] selector The compiled selector to match.
+	/// @return The first matching element, or nullptr if none was found.
+	static Element* QuerySelector(Element* root_element, const ElementSelector& selector);
+	/// Get all descendant elements matching the given selector, in document order.
+	/// @param[out] elements Resulting elements.
+	/// @param[in] root_element The element to search below.
+	/// @param[in] selector The compiled selector to match.
+	static void QuerySelectorAll(ElementList& elements, Element* root_element, const ElementSelector& selector);
 
 	/// Returns an element's density-independent pixel ratio, defined by it's context
 	/// @param[in] element The element to determine the density-independent pixel ratio for.
@@ -52,6 +52,7 @@ class StyleSheet;
 class PropertyDictionary;
 class PropertySpecification;
 class DecoratorInstancerInterface;
+class XMLNodeTree;
 enum class EventId : uint16_t;
 
 /**
@@ -113,6 +114,12 @@ public:
 	/// @param[in] stream The stream to instance from.
 	/// @return The instanced document, or nullptr if an error occurred.
 	static ElementPtr InstanceDocumentStream(Rml::Core::Context* context, Stream* stream);
+	/// Instances a document from a pre-parsed node tree, as held by the document cache.
+	/// @param[in] context The context that is creating the document.
+	/// @param[in] node_tree The parsed document to instance from.
+	/// @param[in] style_sheet The style sheet built in advance from the document's header, or nullptr to build it while instancing.
+	/// @return The instanced document, or nullptr if an error occurred.
+	static ElementPtr InstanceDocumentNodeTree(Rml::Core::Context* context, const XMLNodeTree& node_tree, const SharedPtr<StyleSheet>& style_sheet = nullptr);
 
 	/// Registers a non-owning pointer to an instancer that will be used to instance decorators.
 	/// @param[in] name The name of the decorator the instancer will be called for.
@@ -152,6 +159,8 @@ public:
 	static void ClearStyleSheetCache();
 	/// Clears the template cache. This will force template to be reloaded.
 	static void ClearTemplateCache();
+	/// Clears the document cache. This will force documents loaded from files to be re-read and parsed.
+	static void ClearDocumentCache();
 
 	/// Registers an instancer for all events.
 	/// @param[in] instancer The instancer to be called.
@@ -76,6 +76,10 @@ public:
 	/// Returns the geometry's indices. If these are written to, Release() should be called to force a recompile.
 	/// @return The geometry's index array.
 	std::vector< int >& GetIndices();
+	/// Returns the geometry's quads, rendered before any vertices and indices. If these are written to, Release()
+	/// should be called to force a recompile.
+	/// @return The geometry's quad array.
+	std::vector< QuadInstance >& GetQuads();
 
 	/// Gets the geometry's texture.
 	/// @return The geometry's texture.
@@ -99,10 +103,18 @@ private:
 
 	std::vector< Vertex > vertices;
 	std::vector< int > indices;
+	std::vector< QuadInstance > quads;
+
 	const Texture* texture = nullptr;
 
 	CompiledGeometryHandle compiled_geometry = 0;
+	TextureHandle compiled_texture = 0;
+	// The texture database release generation when the texture handle was last checked.
+	unsigned int compiled_texture_generation = 0;
 	bool compile_attempted = false;
+	// True if the render interface supports the compact format and the geometry can be represented by it. The
+	// vertices and indices remain the exact copy, uncompiled geometry is converted whenever it is rendered.
+	bool compact_convertible = false;
 
 	GeometryDatabaseHandle database_handle;
 };
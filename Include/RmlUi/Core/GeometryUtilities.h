@@ -67,6 +67,23 @@ public:
 	/// @param[in] index_offset The offset to be added to the generated indices; this should be the number of vertices already in the array.
 	static void GenerateQuad(Vertex* vertices, int* indices, const Vector2f& origin, const Vector2f& dimensions, const Colourb& colour, const Vector2f& top_left_texcoord, const Vector2f& bottom_right_texcoord, int index_offset = 0);
 	
+	/// Converts geometry to the compact vertex format with 16-bit indices.
+	/// @param[in] vertices The vertices to convert.
+	/// @param[in] num_vertices The number of vertices.
+	/// @param[in] indices The indices to convert.
+	/// @param[in] num_indices The number of indices.
+	/// @param[out] compact_vertices The converted vertices.
+	/// @param[out] compact_indices The converted indices.
+	/// @return False if the geometry cannot be represented in the compact format, that is, if it has too many vertices or its texture coordinates are outside the range [0, 1].
+	static bool ConvertToCompact(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, std::vector<CompactVertex>& compact_vertices, std::vector<uint16_t>& compact_indices);
+
+	/// Expands quad instances into regular geometry, appending to the given vertex and index arrays.
+	/// @param[in] quads The quads to expand.
+	/// @param[in] num_quads The number of quads.
+	/// @param[in,out] vertices The vertex array to append four vertices per quad to.
+	/// @param[in,out] indices The index array to append six indices per quad to.
+	static void ExpandQuads(const QuadInstance* quads, int num_quads, std::vector<Vertex>& vertices, std::vector<int>& indices);
+
 	/// Generates the geometry required to render a line above, below or through a line of text.
 	/// @param[out] geometry The geometry to append the newly created geometry into.
 	/// @param[in] position The position of the baseline of the lined text.
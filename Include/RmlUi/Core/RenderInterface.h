@@ -81,6 +81,40 @@ public:
 	/// @param[in] geometry The application-specific compiled geometry to release.
 	virtual void ReleaseCompiledGeometry(CompiledGeometryHandle geometry);
 
+	/// Called by RmlUi to query whether the application supports geometry in the compact vertex format with 16-bit
+	/// indices. If supported, all geometry which can be represented in the compact format is submitted through
+	/// RenderCompactGeometry() and CompileCompactGeometry(), the remaining geometry is submitted as usual.
+	/// @return True if the compact geometry functions are implemented.
+	virtual bool SupportsCompactGeometry();
+	/// Called by RmlUi when it wants to render geometry in the compact format, only if supported.
+	/// @param[in] vertices The geometry's vertex data.
+	/// @param[in] num_vertices The number of vertices passed to the function.
+	/// @param[in] indices The geometry's 16-bit index data.
+	/// @param[in] num_indices The number of indices passed to the function. This will always be a multiple of three.
+	/// @param[in] texture The texture to be applied to the geometry. This may be nullptr, in which case the geometry is untextured.
+	/// @param[in] translation The translation to apply to the geometry.
+	virtual void RenderCompactGeometry(CompactVertex* vertices, int num_vertices, uint16_t* indices, int num_indices, TextureHandle texture, const Vector2f& translation);
+	/// Called by RmlUi when it wants to compile geometry in the compact format, only if supported. Otherwise
+	/// identical to CompileGeometry().
+	/// @param[in] vertices The geometry's vertex data.
+	/// @param[in] num_vertices The number of vertices passed to the function.
+	/// @param[in] indices The geometry's 16-bit index data.
+	/// @param[in] num_indices The number of indices passed to the function. This will always be a multiple of three.
+	/// @param[in] texture The texture to be applied to the geometry. This may be nullptr, in which case the geometry is untextured.
+	/// @return The application-specific compiled geometry, or zero to render the geometry through RenderCompactGeometry() instead.
+	virtual CompiledGeometryHandle CompileCompactGeometry(CompactVertex* vertices, int num_vertices, uint16_t* indices, int num_indices, TextureHandle texture);
+
+	/// Called by RmlUi to query whether the application supports rendering quad instances directly. If not
+	/// supported, quads are expanded into regular geometry before being submitted.
+	/// @return True if RenderQuads() is implemented.
+	virtual bool SupportsQuads();
+	/// Called by RmlUi when it wants to render a list of quads, only if supported.
+	/// @param[in] quads The quads to render.
+	/// @param[in] num_quads The number of quads passed to the function.
+	/// @param[in] texture The texture to be applied to the quads. This may be nullptr, in which case the quads are untextured.
+	/// @param[in] translation The translation to apply to the quads.
+	virtual void RenderQuads(QuadInstance* quads, int num_quads, TextureHandle texture, const Vector2f& translation);
+
 	/// Called by RmlUi when it wants to enable or disable scissoring to clip content.
 	/// @param[in] enable True if scissoring is to enabled, false if it is to be disabled.
 	virtual void EnableScissorRegion(bool enable) = 0;
@@ -97,6 +131,14 @@ public:
 	/// @param[in] source The application-defined image source, joined with the path of the referencing document.
 	/// @return True if the load attempt succeeded and the handle and dimensions are valid, false if not.
 	virtual bool LoadTexture(TextureHandle& texture_handle, Vector2i& texture_dimensions, const String& source);
+	/// Called by RmlUi when a texture is to be packed into a runtime texture atlas, see Core::SetTextureAtlas(). Only
+	/// called when texture atlasing is enabled. Textures which are too large for the atlas are afterwards loaded through
+	/// LoadTexture(), thus the implementation can return early for large images if their dimensions are known.
+	/// @param[out] texture_data The raw 8-bit texture data. Each pixel is made up of four 8-bit values, indicating red, green, blue and alpha in that order.
+	/// @param[out] texture_dimensions The variable to write the dimensions of the loaded texture.
+	/// @param[in] source The application-defined image source, joined with the path of the referencing document.
+	/// @return True if the texture data was loaded, false to load the texture through LoadTexture() instead.
+	virtual bool LoadTextureData(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const String& source);
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	/// @param[out] texture_handle The handle to write the texture handle for the generated texture to.
 	/// @param[in] source The raw 8-bit texture data. Each pixel is made up of four 8-bit values, indicating red, green, blue and alpha in that order.
@@ -101,6 +101,10 @@ public:
 	/// Parses the font-effect property from a string and returns a list of instanced font-effects.
 	FontEffectsPtr InstanceFontEffectsFromString(const String& font_effect_string_value, const SharedPtr<const PropertySource>& source) const;
 
+	/// Returns true if any selector in the style sheet depends on the position of elements among their siblings, such as
+	/// :nth-child. Only valid after the node index has been built.
+	bool HasStructuralSelectors() const;
+
 	/// Get sprite located in any spritesheet within this stylesheet.
 	const Sprite* GetSprite(const String& name) const;
 
@@ -134,6 +138,9 @@ private:
 	// Map of all styled nodes, that is, they have one or more properties.
 	NodeIndex styled_node_index;
 
+	// True if any node uses structural pseudo-classes, set when the node index is built.
+	bool has_structural_selectors;
+
 	using ElementDefinitionCache = UnorderedMap< size_t, SharedPtr<ElementDefinition> >;
 	// Index of node sets to element definitions.
 	mutable ElementDefinitionCache node_cache;
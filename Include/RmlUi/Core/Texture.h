@@ -49,6 +49,24 @@ class RenderInterface;
 using TextureCallback = std::function<bool(const String& name, UniquePtr<const byte[]>& data, Vector2i& dimensions)>;
 
 
+/**
+	Statistics of the texture memory used by all textures loaded and generated by RmlUi.
+	Memory usage is estimated from the texture dimensions, assuming four bytes per pixel.
+ */
+
+struct TextureMemoryStatistics
+{
+	// The estimated number of bytes used by all currently loaded textures.
+	size_t memory_usage = 0;
+	// The texture memory budget in bytes, or zero if no budget is set.
+	size_t memory_budget = 0;
+	// The number of textures released to keep the memory usage within the budget.
+	int num_evictions = 0;
+	// The number of evicted textures that have since been loaded again.
+	int num_reloads = 0;
+};
+
+
 /**
 	Abstraction of a two-dimensional texture image, with an application-specific texture handle.
 
@@ -79,6 +97,12 @@ public:
 	/// @param[in] The render interface that is requesting the dimensions.
 	/// @return The texture's dimensions. This will be (0, 0) if the texture isn't loaded.
 	Vector2i GetDimensions(RenderInterface* render_interface) const;
+	/// Maps normalized texture coordinates of this texture to the coordinates to be used with its handle. This is the
+	/// identity mapping, unless the texture has been packed into a runtime texture atlas.
+	/// @param[in] The render interface that is requesting the texture coordinates.
+	/// @param[in] texcoord The normalized texture coordinates within this texture.
+	/// @return The texture coordinates within the texture given by the handle.
+	Vector2f MapTexCoord(RenderInterface* render_interface, const Vector2f& texcoord) const;
 
 	/// Returns true if the texture points to the same underlying resource.
 	bool operator==(const Texture&) const;
@@ -51,6 +51,39 @@ struct RMLUICORE_API Vertex
 	Vector2f tex_coord;
 };
 
+/**
+	A compact vertex format used for rendering when supported by the render interface, see
+	RenderInterface::SupportsCompactGeometry(). Geometry in this format always uses 16-bit indices.
+ */
+
+struct RMLUICORE_API CompactVertex
+{
+	/// Two-dimensional position of the vertex (usually in pixels).
+	Vector2f position;
+	/// RGBA-ordered 8-bit / channel colour.
+	Colourb colour;
+	/// Normalized texture coordinate for any associated texture, where [0, 32767] maps to [0, 1]. This matches the
+	/// signed normalized 16-bit format of graphics APIs.
+	int16_t tex_coord[2];
+};
+
+/**
+	A single textured and coloured rectangle, used to submit quads without expanding them into vertices and indices,
+	see RenderInterface::SupportsQuads().
+ */
+
+struct RMLUICORE_API QuadInstance
+{
+	/// Position of the top-left corner of the quad (usually in pixels).
+	Vector2f position;
+	/// Width and height of the quad.
+	Vector2f size;
+	/// Texture coordinates at the top-left and bottom-right corners of the quad.
+	Vector2f tex_coord[2];
+	/// RGBA-ordered 8-bit / channel colour.
+	Colourb colour;
+};
+
 }
 }
 
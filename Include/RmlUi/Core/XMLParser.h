@@ -58,6 +58,10 @@ public:
 	/// @param[in] handler The custom handler.
 	/// @return The registered XML node handler.
 	static XMLNodeHandler* RegisterNodeHandler(const String& tag, SharedPtr<XMLNodeHandler> handler);
+	/// Returns the custom node handler registered for a given tag.
+	/// @param[in] tag The tag to look up.
+	/// @return The handler registered for the tag, or nullptr if elements with the tag use the default handler.
+	static XMLNodeHandler* GetNodeHandler(const String& tag);
 	/// Releases all registered node handlers. This is called internally.
 	static void ReleaseHandlers();
 
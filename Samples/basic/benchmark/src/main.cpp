@@ -53,7 +53,7 @@ public:
 		}
 	}
 
-	void performance_test()
+	void performance_test(bool patch)
 	{
 		RMLUI_ZoneScoped;
 
@@ -92,7 +92,54 @@ public:
 		}
 
 		if (auto el = document->GetElementById("performance"))
-			el->SetInnerRML(rml);
+		{
+			if (patch)
+				el->PatchInnerRML(rml);
+			else
+				el->SetInnerRML(rml);
+		}
+	}
+
+	// Replaces the rows by appending new ones one by one, optionally within a single batch. Returns the time taken.
+	double append_test(int num_rows, bool batch)
+	{
+		RMLUI_ZoneScoped;
+
+		using namespace Rml::Core;
+
+		Element* el = document ? document->GetElementById("performance") : nullptr;
+		if (!el)
+			return 0.0;
+
+		el->SetInnerRML("");
+
+		const double t0 = Shell::GetElapsedTime();
+
+		if (batch)
+			el->BeginBatch();
+
+		for (int i = 0; i < num_rows; i++)
+		{
+			ElementPtr row = document->CreateElement("div");
+			row->SetClass("row", true);
+
+			ElementPtr route = document->CreateElement("div");
+			route->SetClassNames("col col1");
+			route->AppendChild(document->CreateTextNode(CreateString(32, "Route %d", i)));
+			row->AppendChild(std::move(route));
+
+			ElementPtr status = document->CreateElement("div");
+			status->SetClassNames("col col4");
+			status->AppendChild(document->CreateTextNode("Assigned"));
+			row->AppendChild(std::move(status));
+
+			el->AppendChild(std::move(row));
+		}
+
+		if (batch)
+			el->EndBatch();
+
+		return Shell::GetElapsedTime() - t0;
 	}
 
 	class SimpleEventListener : public Rml::Core::EventListener {
@@ -128,6 +175,10 @@ bool run_loop = true;
 bool single_loop = true;
 bool run_update = true;
 bool single_update = true;
+bool patch_update = false;
+bool append_rows = false;
+bool batch_append = true;
+Rml::Core::String append_result = "none (append 10k rows with A)";
 
 void GameLoop()
 {
@@ -135,15 +186,43 @@ void GameLoop()
 	{
 		single_update = false;
 
-		window->performance_test();
+		window->performance_test(patch_update);
 	}
 
+	if (append_rows)
+	{
+		append_rows = false;
+		run_update = false;
+
+		const int num_rows = 10000;
+		const double append_time = window->append_test(num_rows, batch_append);
+
+		const double t0 = Shell::GetElapsedTime();
+		context->Update();
+		const double update_time = Shell::GetElapsedTime() - t0;
+
+		append_result = Rml::Core::CreateString(100, "%d rows in %.1f ms, next update %.1f ms", num_rows, append_time * 1000.0, update_time * 1000.0);
+	}
+
+	static Rml::Core::LayoutMemoryStatistics layout_statistics = Rml::Core::GetLayoutMemoryStatistics();
+	static float layout_allocations_per_pass = 0;
+	static float layout_heap_allocations_per_pass = 0;
+
 	if (run_loop || single_loop)
 	{
 		single_loop = false;
 	
 		context->Update();
 
+		// Measure the memory allocations made by the layout passes of this update.
+		const Rml::Core::LayoutMemoryStatistics new_layout_statistics = Rml::Core::GetLayoutMemoryStatistics();
+		if (int num_passes = new_layout_statistics.num_passes - layout_statistics.num_passes)
+		{
+			layout_allocations_per_pass = float(new_layout_statistics.num_allocations - layout_statistics.num_allocations) / float(num_passes);
+			layout_heap_allocations_per_pass = float(new_layout_statistics.num_heap_allocations - layout_statistics.num_heap_allocations) / float(num_passes);
+		}
+		layout_statistics = new_layout_statistics;
+
 		shell_renderer->PrepareRenderBuffer();
 		context->Render();
 		shell_renderer->PresentRenderBuffer();
@@ -173,7 +252,9 @@ void GameLoop()
 
 		auto el = window->GetDocument()->GetElementById("fps");
 		count_frames = 0;
-		el->SetInnerRML(Rml::Core::CreateString(20, "FPS: %f", fps_mean));
+		el->SetInnerRML(Rml::Core::CreateString(500, "FPS: %f<br/>Layout: %.0f allocations, %.1f heap allocations per pass (arena size %zu kB)<br/>Update: %s (toggle with P)<br/>Append: %s, %s (toggle with B)",
+			fps_mean, layout_allocations_per_pass, layout_heap_allocations_per_pass, layout_statistics.arena_size / 1024, patch_update ? "PatchInnerRML" : "SetInnerRML",
+			append_result.c_str(), batch_append ? "batched" : "unbatched"));
 	}
 }
 
@@ -213,6 +294,18 @@ public:
 			{
 				run_update = !run_update;
 			}
+			else if (key_identifier == Rml::Core::Input::KI_P)
+			{
+				patch_update = !patch_update;
+			}
+			else if (key_identifier == Rml::Core::Input::KI_A)
+			{
+				append_rows = true;
+			}
+			else if (key_identifier == Rml::Core::Input::KI_B)
+			{
+				batch_append = !batch_append;
+			}
 			else if (key_identifier == Rml::Core::Input::KI_ESCAPE)
 			{
 				Shell::RequestExit();
@@ -45,6 +45,14 @@ public:
 	/// Called by RmlUi when it wants to render geometry that it does not wish to optimise.
 	void RenderGeometry(Rml::Core::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::Core::TextureHandle texture, const Rml::Core::Vector2f& translation) override;
 
+	/// Called by RmlUi to query whether we support geometry in the compact vertex format.
+	bool SupportsCompactGeometry() override;
+	/// Called by RmlUi when it wants to render geometry in the compact vertex format.
+	void RenderCompactGeometry(Rml::Core::CompactVertex* vertices, int num_vertices, uint16_t* indices, int num_indices, Rml::Core::TextureHandle texture, const Rml::Core::Vector2f& translation) override;
+	/// Called by RmlUi to query whether we support rendering quads directly.
+	bool SupportsQuads() override;
+	/// Called by RmlUi when it wants to render a list of quads.
+	void RenderQuads(Rml::Core::QuadInstance* quads, int num_quads, Rml::Core::TextureHandle texture, const Rml::Core::Vector2f& translation) override;
 	/// Called by RmlUi when it wants to compile geometry it believes will be static for the forseeable future.
 	Rml::Core::CompiledGeometryHandle CompileGeometry(Rml::Core::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::Core::TextureHandle texture) override;
 
@@ -60,6 +68,8 @@ public:
 
 	/// Called by RmlUi when a texture is required by the library.
 	bool LoadTexture(Rml::Core::TextureHandle& texture_handle, Rml::Core::Vector2i& texture_dimensions, const Rml::Core::String& source) override;
+	/// Called by RmlUi when a texture is to be packed into a runtime texture atlas.
+	bool LoadTextureData(Rml::Core::UniquePtr<const Rml::Core::byte[]>& texture_data, Rml::Core::Vector2i& texture_dimensions, const Rml::Core::String& source) override;
 	/// Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 	bool GenerateTexture(Rml::Core::TextureHandle& texture_handle, const Rml::Core::byte* source, const Rml::Core::Vector2i& source_dimensions) override;
 	/// Called by RmlUi when a loaded texture is no longer required.
@@ -81,6 +91,7 @@ protected:
 	int m_height;
 	bool m_transform_enabled;
 	void *m_rmlui_context;
+	std::vector<Rml::Core::Vertex> m_quad_vertices;
 	
 #if defined(RMLUI_PLATFORM_MACOSX)
 	AGLContext gl_context;
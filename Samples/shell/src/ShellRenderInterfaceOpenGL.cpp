@@ -70,6 +70,110 @@ void ShellRenderInterfaceOpenGL::RenderGeometry(Rml::Core::Vertex* vertices, int
 	glPopMatrix();
 }
 
+// Called by RmlUi to query whether we support geometry in the compact vertex format.
+bool ShellRenderInterfaceOpenGL::SupportsCompactGeometry()
+{
+	return true;
+}
+
+// Called by RmlUi when it wants to render geometry in the compact vertex format.
+void ShellRenderInterfaceOpenGL::RenderCompactGeometry(Rml::Core::CompactVertex* vertices, int RMLUI_UNUSED_PARAMETER(num_vertices), uint16_t* indices, int num_indices, const Rml::Core::TextureHandle texture, const Rml::Core::Vector2f& translation)
+{
+	RMLUI_UNUSED(num_vertices);
+
+	glPushMatrix();
+	glTranslatef(translation.x, translation.y, 0);
+
+	glVertexPointer(2, GL_FLOAT, sizeof(Rml::Core::CompactVertex), &vertices[0].position);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Rml::Core::CompactVertex), &vertices[0].colour);
+
+	if (!texture)
+	{
+		glDisable(GL_TEXTURE_2D);
+		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	}
+	else
+	{
+		glEnable(GL_TEXTURE_2D);
+		glBindTexture(GL_TEXTURE_2D, (GLuint) texture);
+		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+		glTexCoordPointer(2, GL_SHORT, sizeof(Rml::Core::CompactVertex), &vertices[0].tex_coord);
+
+		// Fixed-function texture coordinates are not normalized, scale them using the texture matrix instead.
+		glMatrixMode(GL_TEXTURE);
+		glPushMatrix();
+		glScalef(1.f / 32767.f, 1.f / 32767.f, 1.f);
+		glMatrixMode(GL_MODELVIEW);
+	}
+
+	glDrawElements(GL_TRIANGLES, num_indices, GL_UNSIGNED_SHORT, indices);
+
+	if (texture)
+	{
+		glMatrixMode(GL_TEXTURE);
+		glPopMatrix();
+		glMatrixMode(GL_MODELVIEW);
+	}
+
+	glPopMatrix();
+}
+
+// Called by RmlUi to query whether we support rendering quads directly.
+bool ShellRenderInterfaceOpenGL::SupportsQuads()
+{
+	return true;
+}
+
+// Called by RmlUi when it wants to render a list of quads.
+void ShellRenderInterfaceOpenGL::RenderQuads(Rml::Core::QuadInstance* quads, int num_quads, const Rml::Core::TextureHandle texture, const Rml::Core::Vector2f& translation)
+{
+	// Fixed-function OpenGL has no instancing, expand the quads into a reusable vertex array drawn as GL_QUADS.
+	m_quad_vertices.resize(4 * num_quads);
+
+	for (int i = 0; i < num_quads; i++)
+	{
+		const Rml::Core::QuadInstance& quad = quads[i];
+		Rml::Core::Vertex* vertices = &m_quad_vertices[4 * i];
+
+		const Rml::Core::Vector2f corners[4] = {
+			Rml::Core::Vector2f(0, 0), Rml::Core::Vector2f(1, 0), Rml::Core::Vector2f(1, 1), Rml::Core::Vector2f(0, 1)
+		};
+
+		for (int j = 0; j < 4; j++)
+		{
+			vertices[j].position = quad.position + Rml::Core::Vector2f(quad.size.x * corners[j].x, quad.size.y * corners[j].y);
+			vertices[j].colour = quad.colour;
+			vertices[j].tex_coord.x = quad.tex_coord[0].x + (quad.tex_coord[1].x - quad.tex_coord[0].x) * corners[j].x;
+			vertices[j].tex_coord.y = quad.tex_coord[0].y + (quad.tex_coord[1].y - quad.tex_coord[0].y) * corners[j].y;
+		}
+	}
+
+	glPushMatrix();
+	glTranslatef(translation.x, translation.y, 0);
+
+	glVertexPointer(2, GL_FLOAT, sizeof(Rml::Core::Vertex), &m_quad_vertices[0].position);
+	glEnableClientState(GL_COLOR_ARRAY);
+	glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(Rml::Core::Vertex), &m_quad_vertices[0].colour);
+
+	if (!texture)
+	{
+		glDisable(GL_TEXTURE_2D);
+		glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	}
+	else
+	{
+		glEnable(GL_TEXTURE_2D);
+		glBindTexture(GL_TEXTURE_2D, (GLuint) texture);
+		glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+		glTexCoordPointer(2, GL_FLOAT, sizeof(Rml::Core::Vertex), &m_quad_vertices[0].tex_coord);
+	}
+
+	glDrawArrays(GL_QUADS, 0, 4 * num_quads);
+
+	glPopMatrix();
+}
+
 // Called by RmlUi when it wants to compile geometry it believes will be static for the forseeable future.		
 Rml::Core::CompiledGeometryHandle ShellRenderInterfaceOpenGL::CompileGeometry(Rml::Core::Vertex* RMLUI_UNUSED_PARAMETER(vertices), int RMLUI_UNUSED_PARAMETER(num_vertices), int* RMLUI_UNUSED_PARAMETER(indices), int RMLUI_UNUSED_PARAMETER(num_indices), const Rml::Core::TextureHandle RMLUI_UNUSED_PARAMETER(texture))
 {
@@ -176,6 +280,16 @@ struct TGAHeader
 
 // Called by RmlUi when a texture is required by the library.		
 bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::Core::TextureHandle& texture_handle, Rml::Core::Vector2i& texture_dimensions, const Rml::Core::String& source)
+{
+	Rml::Core::UniquePtr<const Rml::Core::byte[]> texture_data;
+	if (!LoadTextureData(texture_data, texture_dimensions, source))
+		return false;
+
+	return GenerateTexture(texture_handle, texture_data.get(), texture_dimensions);
+}
+
+// Called by RmlUi when a texture is to be packed into a runtime texture atlas.
+bool ShellRenderInterfaceOpenGL::LoadTextureData(Rml::Core::UniquePtr<const Rml::Core::byte[]>& texture_data, Rml::Core::Vector2i& texture_dimensions, const Rml::Core::String& source)
 {
 	Rml::Core::FileInterface* file_interface = Rml::Core::GetFileInterface();
 	Rml::Core::FileHandle file_handle = file_interface->Open(source);
@@ -208,6 +322,7 @@ bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::Core::TextureHandle& texture_h
 	if (header.dataType != 2)
 	{
 		Rml::Core::Log::Message(Rml::Core::Log::LT_ERROR, "Only 24/32bit uncompressed TGAs are supported.");
+		delete [] buffer;
 		return false;
 	}
 	
@@ -215,6 +330,7 @@ bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::Core::TextureHandle& texture_h
 	if (color_mode < 3)
 	{
 		Rml::Core::Log::Message(Rml::Core::Log::LT_ERROR, "Only 24 and 32bit textures are supported");
+		delete [] buffer;
 		return false;
 	}
 	
@@ -244,12 +360,11 @@ bool ShellRenderInterfaceOpenGL::LoadTexture(Rml::Core::TextureHandle& texture_h
 	texture_dimensions.x = header.width;
 	texture_dimensions.y = header.height;
 	
-	bool success = GenerateTexture(texture_handle, image_dest, texture_dimensions);
+	texture_data.reset(image_dest);
 	
-	delete [] image_dest;
 	delete [] buffer;
 	
-	return success;
+	return true;
 }
 
 // Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Controls/Controls.h"
+#include "../../Include/RmlUi/Core/DataModel.h"
 #include "../../Include/RmlUi/Core/ElementInstancer.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
@@ -45,6 +46,7 @@
 #include "../../Include/RmlUi/Controls/ElementFormControlSelect.h"
 #include "../../Include/RmlUi/Controls/ElementFormControlTextArea.h"
 #include "../../Include/RmlUi/Controls/ElementTabSet.h"
+#include "../../Include/RmlUi/Controls/ElementVirtualList.h"
 #include "../../Include/RmlUi/Controls/ElementProgressBar.h"
 #include "../../Include/RmlUi/Controls/ElementDataGrid.h"
 #include "../../Include/RmlUi/Controls/ElementDataGridExpandButton.h"
@@ -68,6 +70,8 @@ struct ElementInstancers {
 	Ptr tabset  = std::make_unique<ElementInstancerGeneric<ElementTabSet>>();
 
 	Ptr progressbar  = std::make_unique<ElementInstancerGeneric<ElementProgressBar>>();
+
+	Ptr virtuallist = std::make_unique<ElementInstancerGeneric<ElementVirtualList>>();
 	
 	Ptr datagrid = std::make_unique<ElementInstancerGeneric<ElementDataGrid>>();
 	Ptr datagrid_expand = std::make_unique<ElementInstancerGeneric<ElementDataGridExpandButton>>();
@@ -94,6 +98,11 @@ void RegisterElementInstancers()
 
 	Core::Factory::RegisterElementInstancer("progressbar", element_instancers->progressbar.get());
 
+	Core::Factory::RegisterElementInstancer("virtuallist", element_instancers->virtuallist.get());
+
+	// The contents of the virtual list are its row template, with fields using the syntax of data bindings.
+	Core::DataModel::RegisterTemplateTag("virtuallist");
+
 	Core::Factory::RegisterElementInstancer("datagrid", element_instancers->datagrid.get());
 	Core::Factory::RegisterElementInstancer("datagridexpand", element_instancers->datagrid_expand.get());
 	Core::Factory::RegisterElementInstancer("#rmlctl_datagridcell", element_instancers->datagrid_cell.get());
@@ -28,33 +28,12 @@
 
 #include "../../Include/RmlUi/Controls/DataQuery.h"
 #include "../../Include/RmlUi/Controls/DataSource.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include <algorithm>
 
 namespace Rml {
 namespace Controls {
 
-class DataQuerySort
-{
-	public:
-		DataQuerySort(const Rml::Core::StringList& _order_parameters)
-		{
-			order_parameters = _order_parameters;
-		}
-
-		bool operator()(const Rml::Core::StringList& RMLUI_UNUSED_PARAMETER(left), const Rml::Core::StringList& RMLUI_UNUSED_PARAMETER(right))
-		{
-			RMLUI_UNUSED(left);
-			RMLUI_UNUSED(right);
-
-			return false;
-		}
-
-	private:
-		Rml::Core::StringList order_parameters;
-};
-
-
-
 DataQuery::DataQuery(DataSource* data_source, const Rml::Core::String& table, const Rml::Core::String& _fields, int offset, int limit, const Rml::Core::String& order)
 {
 	ExecuteQuery(data_source, table, _fields, offset, limit, order);
@@ -86,6 +65,10 @@ void DataQuery::ExecuteQuery(DataSource* _data_source, const Rml::Core::String&
 	limit = _limit;
 
 	// Set up the field list and field index cache.
+	fields.clear();
+	field_indices.clear();
+	row.clear();
+	row_indices.clear();
 	Rml::Core::StringUtilities::ExpandString(fields, _fields);
 	for (size_t i = 0; i < fields.size(); i++)
 	{
@@ -103,17 +86,13 @@ void DataQuery::ExecuteQuery(DataSource* _data_source, const Rml::Core::String&
 
 	if (!order.empty())
 	{
-		// Fetch the rows from offset to limit.
-		rows.resize(limit);
-		for (int i = 0; i < limit; i++)
-		{
-			data_source->GetRow(rows[i], table, offset + i, fields);
-		}
-
-		// Now sort the rows, based on the ordering requirements.
-		Rml::Core::StringList order_parameters;
-		Rml::Core::StringUtilities::ExpandString(order_parameters, order);
-		std::sort(rows.begin(), rows.end(), DataQuerySort(order_parameters));
+		// Look up the rows from offset to limit in the data source's cached ordering of the table. The rows themselves
+		// are fetched one at a time as we iterate.
+		const std::vector< int >& sorted_rows = data_source->GetSortedRows(table, order);
+		const int first_row = Rml::Core::Math::Clamp(offset, 0, (int)sorted_rows.size());
+		const int last_row = Rml::Core::Math::Clamp(offset + limit, first_row, (int)sorted_rows.size());
+		row_indices.assign(sorted_rows.begin() + first_row, sorted_rows.begin() + last_row);
+		limit = (int)row_indices.size();
 	}
 }
 
@@ -137,7 +116,7 @@ bool DataQuery::NextRow()
 bool DataQuery::IsFieldSet(const Rml::Core::String& field) const
 {
 	FieldIndices::const_iterator itr = field_indices.find(field);
-	if (itr == field_indices.end() || (*itr).second >= rows[current_row].size())
+	if (itr == field_indices.end() || (*itr).second >= row.size())
 	{
 		return false;
 	}
@@ -149,12 +128,9 @@ bool DataQuery::IsFieldSet(const Rml::Core::String& field) const
 
 void DataQuery::LoadRow()
 {
-	RMLUI_ASSERT(current_row <= (int)rows.size());
-	if (current_row >= (int)rows.size())
-	{
-		rows.push_back(Rml::Core::StringList());
-		data_source->GetRow(rows[current_row], table, offset + current_row, fields);
-	}
+	// Only the current row is kept, so its list can be reused for every row.
+	row.clear();
+	data_source->GetRow(row, table, row_indices.empty() ? offset + current_row : row_indices[current_row], fields);
 }
 
 }
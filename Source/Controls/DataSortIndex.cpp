@@ -0,0 +1,401 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "DataSortIndex.h"
+#include "../../Include/RmlUi/Controls/DataSource.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+namespace Rml {
+namespace Controls {
+
+template< typename T >
+static int CompareValues(const T& left, const T& right)
+{
+	return (left < right ? -1 : (right < left ? 1 : 0));
+}
+
+// Orders NaN after every number so the comparison stays a strict weak ordering; NaNs compare equal to each other.
+static int CompareValues(float left, float right)
+{
+	const bool left_nan = std::isnan(left);
+	const bool right_nan = std::isnan(right);
+	if (left_nan || right_nan)
+		return (int)left_nan - (int)right_nan;
+	return (left < right ? -1 : (right < left ? 1 : 0));
+}
+
+static int CompareValues(const Core::StringView& left, const Core::StringView& right)
+{
+	const size_t left_size = left.size();
+	const size_t right_size = right.size();
+	const int comparison = memcmp(left.begin(), right.begin(), std::min(left_size, right_size));
+	if (comparison != 0)
+		return comparison;
+	return CompareValues(left_size, right_size);
+}
+
+// Fetches the typed values of a range of rows, and replaces or inserts them in the key values.
+template< typename T >
+static bool FetchValues(std::vector< T >& key_values, DataSource* data_source, const Rml::Core::String& table, const Rml::Core::String& field, int first_row, int num_rows, bool insert)
+{
+	std::vector< T > values;
+	if (!data_source->GetColumnValues(values, table, field, first_row, num_rows) || (int)values.size() != num_rows)
+		return false;
+
+	if (insert)
+		key_values.insert(key_values.begin() + first_row, values.begin(), values.end());
+	else
+		std::copy(values.begin(), values.end(), key_values.begin() + first_row);
+
+	return true;
+}
+
+DataSortIndex::DataSortIndex(DataSource* _data_source, const Rml::Core::String& _table, const Rml::Core::String& _order) : data_source(_data_source), table(_table), order(_order), num_rows(0), valid(false)
+{
+	Rml::Core::StringList order_parameters;
+	Rml::Core::StringUtilities::ExpandString(order_parameters, order);
+
+	for (const Rml::Core::String& order_parameter : order_parameters)
+	{
+		Rml::Core::StringList parts;
+		Rml::Core::StringUtilities::ExpandString(parts, order_parameter, ' ', '\0', '\0', true);
+		if (parts.empty())
+			continue;
+
+		Key key;
+		key.field = parts[0];
+		key.descending = (parts.size() > 1 && Rml::Core::StringUtilities::ToLower(parts[1]) == "desc");
+		key.type = KeyType::String;
+		keys.push_back(std::move(key));
+	}
+}
+
+DataSortIndex::~DataSortIndex()
+{
+}
+
+bool DataSortIndex::Matches(const Rml::Core::String& _table, const Rml::Core::String& _order) const
+{
+	return table == _table && order == _order;
+}
+
+bool DataSortIndex::Matches(const Rml::Core::String& _table) const
+{
+	return table == _table;
+}
+
+bool DataSortIndex::IsSortedBy(const Rml::Core::StringList& columns) const
+{
+	for (const Key& key : keys)
+	{
+		if (std::find(columns.begin(), columns.end(), key.field) != columns.end())
+			return true;
+	}
+
+	return false;
+}
+
+const std::vector< int >& DataSortIndex::GetSortedRows()
+{
+	if (!valid)
+		Sort();
+
+	return sorted_rows;
+}
+
+void DataSortIndex::OnRowAdd(int first_row_added, int num_rows_added)
+{
+	if (!valid)
+		return;
+
+	if (first_row_added < 0 || first_row_added > num_rows || num_rows_added < 0)
+	{
+		Invalidate();
+		return;
+	}
+
+	for (Key& key : keys)
+	{
+		if (!FetchKeyRange(key, first_row_added, num_rows_added, true))
+		{
+			Invalidate();
+			return;
+		}
+	}
+
+	num_rows += num_rows_added;
+	if (!RefreshViews())
+	{
+		Invalidate();
+		return;
+	}
+
+	for (int& row : sorted_rows)
+	{
+		if (row >= first_row_added)
+			row += num_rows_added;
+	}
+
+	InsertRows(first_row_added, num_rows_added);
+}
+
+void DataSortIndex::OnRowRemove(int first_row_removed, int num_rows_removed)
+{
+	if (!valid)
+		return;
+
+	if (first_row_removed < 0 || num_rows_removed < 0 || first_row_removed + num_rows_removed > num_rows)
+	{
+		Invalidate();
+		return;
+	}
+
+	RemoveRows(first_row_removed, num_rows_removed, true);
+
+	for (Key& key : keys)
+	{
+		switch (key.type)
+		{
+		case KeyType::Int: key.ints.erase(key.ints.begin() + first_row_removed, key.ints.begin() + first_row_removed + num_rows_removed); break;
+		case KeyType::Float: key.floats.erase(key.floats.begin() + first_row_removed, key.floats.begin() + first_row_removed + num_rows_removed); break;
+		case KeyType::String: key.strings.erase(key.strings.begin() + first_row_removed, key.strings.begin() + first_row_removed + num_rows_removed); break;
+		case KeyType::View: break;
+		}
+	}
+
+	num_rows -= num_rows_removed;
+	if (!RefreshViews())
+		Invalidate();
+}
+
+void DataSortIndex::OnRowChange(int first_row_changed, int num_rows_changed)
+{
+	if (!valid)
+		return;
+
+	if (first_row_changed < 0 || num_rows_changed < 0 || first_row_changed + num_rows_changed > num_rows)
+	{
+		Invalidate();
+		return;
+	}
+
+	RemoveRows(first_row_changed, num_rows_changed, false);
+
+	for (Key& key : keys)
+	{
+		if (!FetchKeyRange(key, first_row_changed, num_rows_changed, false))
+		{
+			Invalidate();
+			return;
+		}
+	}
+
+	if (!RefreshViews())
+	{
+		Invalidate();
+		return;
+	}
+
+	InsertRows(first_row_changed, num_rows_changed);
+}
+
+void DataSortIndex::Invalidate()
+{
+	valid = false;
+	num_rows = 0;
+
+	sorted_rows.clear();
+	sorted_rows.shrink_to_fit();
+
+	for (Key& key : keys)
+	{
+		key.ints.clear();
+		key.floats.clear();
+		key.views.clear();
+		key.strings.clear();
+	}
+}
+
+bool DataSortIndex::FetchKey(Key& key)
+{
+	key.ints.clear();
+	key.floats.clear();
+	key.views.clear();
+	key.strings.clear();
+
+	if (data_source->GetColumnValues(key.ints, table, key.field, 0, num_rows) && (int)key.ints.size() == num_rows)
+	{
+		key.type = KeyType::Int;
+		return true;
+	}
+	key.ints.clear();
+
+	if (data_source->GetColumnValues(key.floats, table, key.field, 0, num_rows) && (int)key.floats.size() == num_rows)
+	{
+		key.type = KeyType::Float;
+		return true;
+	}
+	key.floats.clear();
+
+	if (data_source->GetColumnValues(key.views, table, key.field, 0, num_rows) && (int)key.views.size() == num_rows)
+	{
+		key.type = KeyType::View;
+		return true;
+	}
+	key.views.clear();
+
+	// The data source doesn't store the values as strings we can refer to, fall back to copying them from the rows.
+	key.type = KeyType::String;
+	key.strings.resize(num_rows);
+	return FetchKeyRange(key, 0, num_rows, false);
+}
+
+bool DataSortIndex::FetchKeyRange(Key& key, int first_row, int num_rows_to_fetch, bool insert)
+{
+	switch (key.type)
+	{
+	case KeyType::Int:
+		return FetchValues(key.ints, data_source, table, key.field, first_row, num_rows_to_fetch, insert);
+	case KeyType::Float:
+		return FetchValues(key.floats, data_source, table, key.field, first_row, num_rows_to_fetch, insert);
+	case KeyType::View:
+		// Views are fetched for the whole table once the rows have been updated.
+		return true;
+	case KeyType::String:
+	{
+		if (insert)
+			key.strings.insert(key.strings.begin() + first_row, num_rows_to_fetch, Rml::Core::String());
+
+		const Rml::Core::StringList columns(1, key.field);
+		Rml::Core::StringList row;
+		for (int i = 0; i < num_rows_to_fetch; i++)
+		{
+			row.clear();
+			data_source->GetRow(row, table, first_row + i, columns);
+			key.strings[first_row + i] = (row.empty() ? Rml::Core::String() : std::move(row[0]));
+		}
+		return true;
+	}
+	}
+
+	return false;
+}
+
+bool DataSortIndex::RefreshViews()
+{
+	for (Key& key : keys)
+	{
+		if (key.type == KeyType::View)
+		{
+			key.views.clear();
+			if (!data_source->GetColumnValues(key.views, table, key.field, 0, num_rows) || (int)key.views.size() != num_rows)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void DataSortIndex::Sort()
+{
+	valid = false;
+	num_rows = data_source->GetNumRows(table);
+
+	for (Key& key : keys)
+	{
+		if (!FetchKey(key))
+		{
+			Invalidate();
+			return;
+		}
+	}
+
+	SortRows();
+	valid = true;
+}
+
+void DataSortIndex::SortRows()
+{
+	sorted_rows.resize(num_rows);
+	std::iota(sorted_rows.begin(), sorted_rows.end(), 0);
+	std::sort(sorted_rows.begin(), sorted_rows.end(), [this](int left, int right) { return Less(left, right); });
+}
+
+void DataSortIndex::InsertRows(int first_row, int num_rows_to_insert)
+{
+	// Sort the new rows on their own and merge them with the sorted ones, rather than inserting them one at a time.
+	const auto less = [this](int left, int right) { return Less(left, right); };
+	const size_t num_sorted_rows = sorted_rows.size();
+
+	sorted_rows.resize(num_sorted_rows + num_rows_to_insert);
+	std::iota(sorted_rows.begin() + num_sorted_rows, sorted_rows.end(), first_row);
+	std::sort(sorted_rows.begin() + num_sorted_rows, sorted_rows.end(), less);
+	std::inplace_merge(sorted_rows.begin(), sorted_rows.begin() + num_sorted_rows, sorted_rows.end(), less);
+}
+
+void DataSortIndex::RemoveRows(int first_row, int num_rows_to_remove, bool shift)
+{
+	const int last_row = first_row + num_rows_to_remove;
+	sorted_rows.erase(std::remove_if(sorted_rows.begin(), sorted_rows.end(), [first_row, last_row](int row) { return row >= first_row && row < last_row; }), sorted_rows.end());
+
+	if (shift)
+	{
+		for (int& row : sorted_rows)
+		{
+			if (row >= last_row)
+				row -= num_rows_to_remove;
+		}
+	}
+}
+
+bool DataSortIndex::Less(int left, int right) const
+{
+	for (const Key& key : keys)
+	{
+		int comparison = 0;
+		switch (key.type)
+		{
+		case KeyType::Int: comparison = CompareValues(key.ints[left], key.ints[right]); break;
+		case KeyType::Float: comparison = CompareValues(key.floats[left], key.floats[right]); break;
+		case KeyType::View: comparison = CompareValues(key.views[left], key.views[right]); break;
+		case KeyType::String: comparison = key.strings[left].compare(key.strings[right]); break;
+		}
+
+		if (comparison != 0)
+			return (key.descending ? comparison > 0 : comparison < 0);
+	}
+
+	// Keep rows with equal keys in table order.
+	return left < right;
+}
+
+}
+}
@@ -0,0 +1,124 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICONTROLSDATASORTINDEX_H
+#define RMLUICONTROLSDATASORTINDEX_H
+
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+namespace Controls {
+
+class DataSource;
+
+/**
+	A cached ordering of the rows of a data source's table, stored as a permutation of the row indices. The sort keys
+	are fetched one column at a time through the typed column interface of the data source, so rows are never copied
+	and values are never converted during comparisons. The ordering is updated incrementally as the data source
+	notifies of rows being added, removed or changed.
+ */
+
+class DataSortIndex
+{
+public:
+	/// Constructs the index for a table.
+	/// @param[in] data_source The data source owning the table.
+	/// @param[in] table The name of the table to sort.
+	/// @param[in] order A comma-separated list of the fields to sort by, each optionally followed by 'desc' to sort in descending order.
+	DataSortIndex(DataSource* data_source, const Rml::Core::String& table, const Rml::Core::String& order);
+	~DataSortIndex();
+
+	/// Returns true if this index sorts the given table in the given order.
+	bool Matches(const Rml::Core::String& table, const Rml::Core::String& order) const;
+	/// Returns true if this index sorts the given table.
+	bool Matches(const Rml::Core::String& table) const;
+	/// Returns true if any of the given columns are used as sort keys.
+	bool IsSortedBy(const Rml::Core::StringList& columns) const;
+
+	/// Returns the row indices of the table in sorted order, sorting the table first if the index is invalid.
+	const std::vector< int >& GetSortedRows();
+
+	/// Updates the index for rows added to the table.
+	void OnRowAdd(int first_row_added, int num_rows_added);
+	/// Updates the index for rows removed from the table.
+	void OnRowRemove(int first_row_removed, int num_rows_removed);
+	/// Updates the index for rows changed in the table.
+	void OnRowChange(int first_row_changed, int num_rows_changed);
+	/// Discards the ordering, the table is sorted again the next time it is requested.
+	void Invalidate();
+
+private:
+	enum class KeyType { Int, Float, View, String };
+
+	struct Key
+	{
+		Rml::Core::String field;
+		bool descending;
+		KeyType type;
+
+		// The key values of each row in the table, only the list matching the key type is used.
+		std::vector< int > ints;
+		std::vector< float > floats;
+		std::vector< Core::StringView > views;
+		Rml::Core::StringList strings;
+	};
+
+	// Fetches the values of the whole table for a key, choosing the key type from the first conversion that succeeds.
+	bool FetchKey(Key& key);
+	// Fetches the values of a range of rows for a key of an already known type, replacing or inserting them at the
+	// range in the key's value list.
+	bool FetchKeyRange(Key& key, int first_row, int num_rows, bool insert);
+	// Fetches the values of all string view keys again, as the views are only valid until the data source changes.
+	bool RefreshViews();
+
+	// Fetches the keys of the whole table and sorts it.
+	void Sort();
+	// Sorts all the rows of the table using the current keys.
+	void SortRows();
+	// Sorts the rows in the given range and merges them into the sorted rows.
+	void InsertRows(int first_row, int num_rows);
+	// Removes the rows in the given range from the ordering, and shifts the following rows down if requested.
+	void RemoveRows(int first_row, int num_rows, bool shift);
+	// Returns true if the left row sorts before the right row.
+	bool Less(int left, int right) const;
+
+	DataSource* data_source;
+	Rml::Core::String table;
+	Rml::Core::String order;
+
+	std::vector< Key > keys;
+	std::vector< int > sorted_rows;
+	int num_rows;
+	bool valid;
+};
+
+}
+}
+
+#endif
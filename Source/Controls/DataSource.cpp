@@ -30,7 +30,11 @@
 #include "../../Include/RmlUi/Controls/DataSourceListener.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/Log.h"
+#include "DataSortIndex.h"
 #include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
 
 namespace Rml {
 namespace Controls {
@@ -63,6 +67,8 @@ DataSource::~DataSource()
 		(*i)->OnDataSourceDestroy(this);
 	}
 
+	sort_indices.clear();
+
 	DataSourceMap::iterator iterator = data_sources.find(name);
 	if (iterator != data_sources.end() &&
 		iterator->second == this)
@@ -87,6 +93,76 @@ DataSource* DataSource::GetDataSource(const Rml::Core::String& data_source_name)
 	return (*i).second;
 }
 
+bool DataSource::GetColumnValues(std::vector< int >& values, const Rml::Core::String& table, const Rml::Core::String& column, int first_row, int num_rows)
+{
+	values.resize(num_rows);
+
+	const Rml::Core::StringList columns(1, column);
+	Rml::Core::StringList row;
+	for (int i = 0; i < num_rows; i++)
+	{
+		row.clear();
+		GetRow(row, table, first_row + i, columns);
+
+		// Only accept values which are integers in their entirety, and which fit an int; otherwise the column is
+		// compared as floats or strings instead.
+		char* end = nullptr;
+		errno = 0;
+		const long value = (row.empty() ? 0 : strtol(row[0].c_str(), &end, 10));
+		if (row.empty() || row[0].empty() || *end != '\0' || errno == ERANGE || value < INT_MIN || value > INT_MAX)
+			return false;
+
+		values[i] = (int)value;
+	}
+
+	return true;
+}
+
+bool DataSource::GetColumnValues(std::vector< float >& values, const Rml::Core::String& table, const Rml::Core::String& column, int first_row, int num_rows)
+{
+	values.resize(num_rows);
+
+	const Rml::Core::StringList columns(1, column);
+	Rml::Core::StringList row;
+	for (int i = 0; i < num_rows; i++)
+	{
+		row.clear();
+		GetRow(row, table, first_row + i, columns);
+
+		char* end = nullptr;
+		const float value = (row.empty() ? 0.f : strtof(row[0].c_str(), &end));
+		if (row.empty() || row[0].empty() || *end != '\0')
+			return false;
+
+		values[i] = value;
+	}
+
+	return true;
+}
+
+bool DataSource::GetColumnValues(std::vector< Core::StringView >& RMLUI_UNUSED_PARAMETER(values), const Rml::Core::String& RMLUI_UNUSED_PARAMETER(table), const Rml::Core::String& RMLUI_UNUSED_PARAMETER(column), int RMLUI_UNUSED_PARAMETER(first_row), int RMLUI_UNUSED_PARAMETER(num_rows))
+{
+	RMLUI_UNUSED(values);
+	RMLUI_UNUSED(table);
+	RMLUI_UNUSED(column);
+	RMLUI_UNUSED(first_row);
+	RMLUI_UNUSED(num_rows);
+
+	return false;
+}
+
+const std::vector< int >& DataSource::GetSortedRows(const Rml::Core::String& table, const Rml::Core::String& order)
+{
+	for (auto& sort_index : sort_indices)
+	{
+		if (sort_index->Matches(table, order))
+			return sort_index->GetSortedRows();
+	}
+
+	sort_indices.push_back(std::make_unique< DataSortIndex >(this, table, order));
+	return sort_indices.back()->GetSortedRows();
+}
+
 void DataSource::AttachListener(DataSourceListener* listener)
 {
 	if (find(listeners.begin(), listeners.end(), listener) != listeners.end())
@@ -114,6 +190,12 @@ void* DataSource::GetScriptObject() const
 
 void DataSource::NotifyRowAdd(const Rml::Core::String& table, int first_row_added, int num_rows_added)
 {
+	for (auto& sort_index : sort_indices)
+	{
+		if (sort_index->Matches(table))
+			sort_index->OnRowAdd(first_row_added, num_rows_added);
+	}
+
 	ListenerList listeners_copy = listeners;
 	for (ListenerList::iterator i = listeners_copy.begin(); i != listeners_copy.end(); ++i)
 	{
@@ -123,6 +205,12 @@ void DataSource::NotifyRowAdd(const Rml::Core::String& table, int first_row_adde
 
 void DataSource::NotifyRowRemove(const Rml::Core::String& table, int first_row_removed, int num_rows_removed)
 {
+	for (auto& sort_index : sort_indices)
+	{
+		if (sort_index->Matches(table))
+			sort_index->OnRowRemove(first_row_removed, num_rows_removed);
+	}
+
 	ListenerList listeners_copy = listeners;
 	for (ListenerList::iterator i = listeners_copy.begin(); i != listeners_copy.end(); ++i)
 	{
@@ -132,6 +220,12 @@ void DataSource::NotifyRowRemove(const Rml::Core::String& table, int first_row_r
 
 void DataSource::NotifyRowChange(const Rml::Core::String& table, int first_row_changed, int num_rows_changed)
 {
+	for (auto& sort_index : sort_indices)
+	{
+		if (sort_index->Matches(table))
+			sort_index->OnRowChange(first_row_changed, num_rows_changed);
+	}
+
 	ListenerList listeners_copy = listeners;
 	for (ListenerList::iterator i = listeners_copy.begin(); i != listeners_copy.end(); ++i)
 	{
@@ -139,8 +233,30 @@ void DataSource::NotifyRowChange(const Rml::Core::String& table, int first_row_c
 	}
 }
 
+void DataSource::NotifyRowChange(const Rml::Core::String& table, int first_row_changed, int num_rows_changed, const Rml::Core::StringList& columns_changed)
+{
+	// Orderings only need updating if their keys have changed.
+	for (auto& sort_index : sort_indices)
+	{
+		if (sort_index->Matches(table) && sort_index->IsSortedBy(columns_changed))
+			sort_index->OnRowChange(first_row_changed, num_rows_changed);
+	}
+
+	ListenerList listeners_copy = listeners;
+	for (ListenerList::iterator i = listeners_copy.begin(); i != listeners_copy.end(); ++i)
+	{
+		(*i)->OnColumnChange(this, table, first_row_changed, num_rows_changed, columns_changed);
+	}
+}
+
 void DataSource::NotifyRowChange(const Rml::Core::String& table)
 {
+	for (auto& sort_index : sort_indices)
+	{
+		if (sort_index->Matches(table))
+			sort_index->Invalidate();
+	}
+
 	ListenerList listeners_copy = listeners;
 	for (ListenerList::iterator i = listeners_copy.begin(); i != listeners_copy.end(); ++i)
 	{
@@ -75,6 +75,13 @@ void DataSourceListener::OnRowChange(DataSource* RMLUI_UNUSED_PARAMETER(data_sou
 	RMLUI_UNUSED(num_rows_changed);
 }
 
+// Notification of the changing of some of the columns of one or more rows from an observed data source's table.
+void DataSourceListener::OnColumnChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed, const Rml::Core::StringList& RMLUI_UNUSED_PARAMETER(columns_changed))
+{
+	RMLUI_UNUSED(columns_changed);
+	OnRowChange(data_source, table, first_row_changed, num_rows_changed);
+}
+
 // Notification of the change of all of the data of an observed data source's table.
 void DataSourceListener::OnRowChange(DataSource* RMLUI_UNUSED_PARAMETER(data_source), const Rml::Core::String& RMLUI_UNUSED_PARAMETER(table))
 {
@@ -36,6 +36,8 @@
 #include "../../Include/RmlUi/Core/Property.h"
 #include "../../Include/RmlUi/Controls/DataFormatter.h"
 #include "../../Include/RmlUi/Controls/ElementDataGridRow.h"
+#include "../../Include/RmlUi/Controls/DataQuery.h"
+#include "RowWindow.h"
 
 namespace Rml {
 namespace Controls {
@@ -67,10 +69,18 @@ ElementDataGrid::ElementDataGrid(const Rml::Core::String& tag) : Core::Element(t
 	SetProperty(Core::PropertyId::OverflowY, Core::Property(Core::Style::Overflow::Auto));
 
 	new_data_source = "";
+
+	window_data_source = nullptr;
+	window_num_rows = 0;
 }
 
 ElementDataGrid::~ElementDataGrid()
 {
+	if (window_data_source)
+	{
+		window_data_source->DetachListener(this);
+		window_data_source = nullptr;
+	}
 }
 
 void ElementDataGrid::SetDataSource(const Rml::Core::String& data_source_name)
@@ -140,7 +150,10 @@ void ElementDataGrid::AddColumn(const Rml::Core::String& fields, const Rml::Core
 	parameters["index"] = (int)(columns.size() - 1);
 	if (DispatchEvent(Core::EventId::Columnadd, parameters))
 	{
-		root->RefreshRows();
+		if (window)
+			window->Clear(false);
+		else
+			root->RefreshRows();
 		DirtyLayout();
 	}
 }
@@ -212,26 +225,41 @@ void ElementDataGrid::RemoveRows(int index, int num_rows)
 // Returns the number of rows in the table
 int ElementDataGrid::GetNumRows() const
 {
+	if (window)
+		return window_num_rows;
+
 	return body->GetNumChildren();
 }
 
 // Returns the row at the given index in the table.
 ElementDataGridRow* ElementDataGrid::GetRow(int index) const
 {
+	if (window)
+		return static_cast< ElementDataGridRow* >(window->GetRow(index));
+
 	// We need to add two to the index, to skip the header row.
 	ElementDataGridRow* row = rmlui_dynamic_cast< ElementDataGridRow* >(body->GetChild(index));
 	return row;
 }
 
+// Returns true if the grid only instances its visible rows.
+bool ElementDataGrid::IsWindowed() const
+{
+	return window != nullptr;
+}
+
 void ElementDataGrid::OnUpdate()
 {
 	if (!new_data_source.empty())
 	{
-		root->SetDataSource(new_data_source);
+		if (HasAttribute("windowed"))
+			SetWindowDataSource(new_data_source);
+		else
+			root->SetDataSource(new_data_source);
 		new_data_source = "";
 	}
 
-	bool any_new_children = root->UpdateChildren();
+	bool any_new_children = (window ? UpdateWindow() : root->UpdateChildren());
 	if (any_new_children)
 	{
 		DispatchEvent(Core::EventId::Rowupdate, Rml::Core::Dictionary());
@@ -250,6 +278,181 @@ void ElementDataGrid::OnResize()
 	}
 }
 
+void ElementDataGrid::OnDataSourceDestroy(DataSource* data_source)
+{
+	if (data_source == window_data_source)
+	{
+		window_data_source->DetachListener(this);
+		window_data_source = nullptr;
+		window_data_table = "";
+		window->SetDirty();
+	}
+}
+
+void ElementDataGrid::OnRowAdd(DataSource* data_source, const Rml::Core::String& table, int first_row_added, int num_rows_added)
+{
+	if (data_source != window_data_source || table != window_data_table)
+		return;
+
+	window->SetDirty();
+
+	Rml::Core::Dictionary parameters;
+	parameters["first_row_added"] = first_row_added;
+	parameters["num_rows_added"] = num_rows_added;
+	DispatchEvent(Core::EventId::Rowadd, parameters);
+}
+
+void ElementDataGrid::OnRowRemove(DataSource* data_source, const Rml::Core::String& table, int first_row_removed, int num_rows_removed)
+{
+	if (data_source != window_data_source || table != window_data_table)
+		return;
+
+	window->SetDirty();
+
+	Rml::Core::Dictionary parameters;
+	parameters["first_row_removed"] = first_row_removed;
+	parameters["num_rows_removed"] = num_rows_removed;
+	DispatchEvent(Core::EventId::Rowremove, parameters);
+}
+
+void ElementDataGrid::OnRowChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed)
+{
+	if (data_source != window_data_source || table != window_data_table)
+		return;
+
+	// Only the instanced rows within the changed range need to be reloaded.
+	const int window_first_row = window->GetFirstRow();
+	const int first_row_to_load = Rml::Core::Math::Max(first_row_changed, window_first_row);
+	const int last_row_to_load = Rml::Core::Math::Min(first_row_changed + num_rows_changed, window_first_row + (int)window->GetRows().size());
+	if (first_row_to_load < last_row_to_load)
+		LoadWindowRows(first_row_to_load, last_row_to_load - first_row_to_load);
+
+	Rml::Core::Dictionary parameters;
+	parameters["first_row_changed"] = first_row_changed;
+	parameters["num_rows_changed"] = num_rows_changed;
+	DispatchEvent(Core::EventId::Rowchange, parameters);
+}
+
+void ElementDataGrid::OnColumnChange(DataSource* data_source, const Rml::Core::String& table, int first_row_changed, int num_rows_changed, const Rml::Core::StringList& columns_changed)
+{
+	if (data_source != window_data_source || table != window_data_table)
+		return;
+
+	// Mark only the changed fields of the instanced rows as dirty, so the other cells are skipped when loading.
+	const int window_first_row = window->GetFirstRow();
+	const int first_row_to_load = Rml::Core::Math::Max(first_row_changed, window_first_row);
+	const int last_row_to_load = Rml::Core::Math::Min(first_row_changed + num_rows_changed, window_first_row + (int)window->GetRows().size());
+	for (int i = first_row_to_load; i < last_row_to_load; i++)
+		static_cast< ElementDataGridRow* >(window->GetRow(i))->DirtyCells(columns_changed);
+
+	OnRowChange(data_source, table, first_row_changed, num_rows_changed);
+}
+
+void ElementDataGrid::OnRowChange(DataSource* data_source, const Rml::Core::String& table)
+{
+	if (data_source == window_data_source && table == window_data_table)
+		window->SetDirty();
+}
+
+// Sets the data source of a windowed grid.
+void ElementDataGrid::SetWindowDataSource(const Rml::Core::String& data_source_name)
+{
+	if (window_data_source)
+	{
+		window_data_source->DetachListener(this);
+		window_data_source = nullptr;
+	}
+
+	if (!window)
+	{
+		window = std::make_unique< RowWindow >(this,
+			[this]() {
+				Core::ElementPtr element = Core::Factory::InstanceElement(this, "#rmlctl_datagridrow", "datagridrow", Rml::Core::XMLAttributes());
+				static_cast< ElementDataGridRow* >(element.get())->Initialise(this, nullptr, 0, header, 0);
+				return element;
+			},
+			[](Core::Element* element, int index) {
+				// Rows without a parent row take their table index from here.
+				ElementDataGridRow* row = static_cast< ElementDataGridRow* >(element);
+				row->child_index = index;
+				row->table_relative_index = index;
+				row->DirtyCells();
+			}
+		);
+
+		Rml::Core::XMLAttributes attributes;
+		Core::ElementPtr element = Core::Factory::InstanceElement(this, "*", "datagridspacer", attributes);
+		element->SetProperty(Core::PropertyId::Display, Core::Property(Core::Style::Display::Block));
+		Core::Element* top_spacer = body->InsertBefore(std::move(element), body->GetFirstChild());
+
+		element = Core::Factory::InstanceElement(this, "*", "datagridspacer", attributes);
+		element->SetProperty(Core::PropertyId::Display, Core::Property(Core::Style::Display::Block));
+		Core::Element* bottom_spacer = body->AppendChild(std::move(element));
+
+		window->SetSpacers(top_spacer, bottom_spacer);
+	}
+
+	if (ParseDataSource(window_data_source, window_data_table, data_source_name))
+		window_data_source->AttachListener(this);
+
+	window->SetDirty();
+}
+
+// Instances, recycles and loads the rows of a windowed grid to cover the current scroll position.
+bool ElementDataGrid::UpdateWindow()
+{
+	if (window->IsDirty())
+		window_num_rows = (window_data_source ? window_data_source->GetNumRows(window_data_table) : 0);
+
+	window->SetFixedRowHeight(GetAttribute< float >("row-height", 0.0f));
+	window->SetOverscan(GetAttribute< int >("overscan", 4));
+
+	// Find the part of the body visible within our client area.
+	const float visible_top = GetAbsoluteOffset(Core::Box::PADDING).y - body->GetAbsoluteOffset(Core::Box::BORDER).y;
+	window->Update(window_num_rows, visible_top, GetClientHeight());
+
+	// Load contiguous ranges of dirty rows with one query each.
+	const int window_first_row = window->GetFirstRow();
+	const std::vector< Core::Element* >& window_rows = window->GetRows();
+
+	bool any_rows_loaded = false;
+	for (int i = 0; i < (int)window_rows.size(); i++)
+	{
+		if (!static_cast< ElementDataGridRow* >(window_rows[i])->dirty_cells)
+			continue;
+
+		int num_rows_to_load = 1;
+		while (i + num_rows_to_load < (int)window_rows.size() && static_cast< ElementDataGridRow* >(window_rows[i + num_rows_to_load])->dirty_cells)
+			num_rows_to_load++;
+
+		LoadWindowRows(window_first_row + i, num_rows_to_load);
+		any_rows_loaded = true;
+		i += num_rows_to_load - 1;
+	}
+
+	return any_rows_loaded;
+}
+
+// Loads a range of instanced rows of a windowed grid from the data source.
+void ElementDataGrid::LoadWindowRows(int first_row_to_load, int num_rows_to_load)
+{
+	if (!window_data_source)
+		return;
+
+	DataQuery query(window_data_source, window_data_table, column_fields, first_row_to_load, num_rows_to_load);
+
+	for (int i = 0; i < num_rows_to_load; i++)
+	{
+		if (!query.NextRow())
+		{
+			Core::Log::Message(Rml::Core::Log::LT_WARNING, "Failed to load row %d from data source %s", first_row_to_load + i, window_data_table.c_str());
+			break;
+		}
+
+		static_cast< ElementDataGridRow* >(window->GetRow(first_row_to_load + i))->Load(query);
+	}
+}
+
 // Gets the markup and content of the element.
 void ElementDataGrid::GetInnerRML(Rml::Core::String& content) const
 {
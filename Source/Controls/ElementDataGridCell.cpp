@@ -29,6 +29,11 @@
 #include "../../Include/RmlUi/Controls/ElementDataGridCell.h"
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/Property.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Controls/ElementDataGrid.h"
 
 namespace Rml {
@@ -58,5 +63,43 @@ int ElementDataGridCell::GetColumn()
 	return column;
 }
 
+// Sets the contents of the cell from the formatted data of its column.
+void ElementDataGridCell::SetFormattedData(const Rml::Core::String& data)
+{
+	if (data == formatted_data)
+		return;
+
+	formatted_data = data;
+
+	// If the cell only holds a single text element and the new data translates to plain text, we can just change the text.
+	Core::Element* child = (GetNumChildren(true) == 1 ? GetChild(0) : nullptr);
+	Core::ElementText* text_element = (child ? rmlui_dynamic_cast< Core::ElementText* >(child) : nullptr);
+	if (text_element)
+	{
+		Rml::Core::String translated_data = formatted_data;
+		Core::SystemInterface* system_interface = Core::GetSystemInterface();
+		if ((system_interface == nullptr || system_interface->TranslateString(translated_data, formatted_data) == 0) &&
+			translated_data.find("<") == Rml::Core::String::npos)
+		{
+			for (char c : translated_data)
+			{
+				if (!Core::StringUtilities::IsWhitespace(c))
+				{
+					text_element->SetText(translated_data);
+					return;
+				}
+			}
+		}
+	}
+
+	// Otherwise, remove all the cell's current contents and instance the new contents.
+	while (GetNumChildren(true) > 0)
+	{
+		RemoveChild(GetChild(0));
+	}
+
+	Core::Factory::InstanceElementText(this, formatted_data);
+}
+
 }
 }
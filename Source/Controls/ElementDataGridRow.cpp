@@ -34,6 +34,7 @@
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../Core/Clock.h"
+#include <algorithm>
 
 namespace Rml {
 namespace Controls {
@@ -226,9 +227,10 @@ int ElementDataGridRow::GetParentRelativeIndex()
 // Returns the index of this row, relative to the table rather than its parent.
 int ElementDataGridRow::GetTableRelativeIndex()
 {
+	// Rows without a parent are either the header, the root, or rows of a windowed grid which have their index set by the grid.
 	if (!parent_row)
 	{
-		return -1;
+		return table_relative_index;
 	}
 
 	if (table_relative_index_dirty)
@@ -280,6 +282,12 @@ void ElementDataGridRow::OnRowChange(DataSource* _data_source, const Rml::Core::
 		ChangeChildren(first_row_changed, num_rows_changed);
 }
 
+void ElementDataGridRow::OnColumnChange(DataSource* _data_source, const Rml::Core::String& _data_table, int first_row_changed, int num_rows_changed, const Rml::Core::StringList& columns_changed)
+{
+	if (_data_source == data_source && _data_table == data_table)
+		ChangeChildren(first_row_changed, num_rows_changed, columns_changed);
+}
+
 void ElementDataGridRow::OnRowChange(DataSource* _data_source, const Rml::Core::String& _data_table)
 {
 	if (_data_source == data_source && _data_table == data_table)
@@ -439,10 +447,15 @@ void ElementDataGridRow::RemoveChildren(int first_row_removed, int num_rows_remo
 	parent_grid->DispatchEvent(Core::EventId::Rowremove, parameters);
 }
 
-void ElementDataGridRow::ChangeChildren(int first_row_changed, int num_rows_changed)
+void ElementDataGridRow::ChangeChildren(int first_row_changed, int num_rows_changed, const Rml::Core::StringList& changed_fields)
 {
 	for (int i = first_row_changed; i < first_row_changed + num_rows_changed; i++)
-		children[i]->DirtyCells();
+	{
+		if (changed_fields.empty())
+			children[i]->DirtyCells();
+		else
+			children[i]->DirtyCells(changed_fields);
+	}
 
 	Rml::Core::Dictionary parameters;
 	parameters["first_row_changed"] = GetChildTableRelativeIndex(first_row_changed);
@@ -465,9 +478,14 @@ int ElementDataGridRow::GetNumDescendants()
 // Adds the cell contents, and marks the row as loaded.
 void ElementDataGridRow::Load(const DataQuery& row_information)
 {
+	// Returns true if the given field needs to be reloaded.
+	auto IsFieldDirty = [this](const Rml::Core::String& field) {
+		return dirty_fields.empty() || std::find(dirty_fields.begin(), dirty_fields.end(), field) != dirty_fields.end();
+	};
+
 	// Check for a data source. If they're both set then we set
 	// ourselves up with it.
-	if (row_information.IsFieldSet(DataSource::CHILD_SOURCE))
+	if (IsFieldDirty(DataSource::CHILD_SOURCE) && row_information.IsFieldSet(DataSource::CHILD_SOURCE))
 	{
 		Rml::Core::String data_source = row_information.Get< Rml::Core::String >(DataSource::CHILD_SOURCE, "");
 		if (!data_source.empty())
@@ -491,6 +509,10 @@ void ElementDataGridRow::Load(const DataQuery& row_information)
 			// Fetch the column:
 			const ElementDataGrid::Column* column = parent_grid->GetColumn(i);
 
+			// Skip the column if none of its fields have changed.
+			if (!dirty_fields.empty() && std::none_of(column->fields.begin(), column->fields.end(), IsFieldDirty))
+				continue;
+
 			// Now we use the column's formatter to process the raw data into the
 			// XML string, and parse that into the actual Core::Elements. If there is
 			// no formatter, then we just send through the raw text, in CVS form.
@@ -534,14 +556,8 @@ void ElementDataGridRow::Load(const DataQuery& row_information)
 				}
 			}
 
-			// Remove all the cell's current contents.
-			while (cell->GetNumChildren(true) > 0)
-			{
-				cell->RemoveChild(cell->GetChild(0));
-			}
-
-			// Add the new contents to the cell.
-			Core::Factory::InstanceElementText(cell, cell_string);
+			// Only touch the cell's elements if its contents have changed.
+			static_cast< ElementDataGridCell* >(cell)->SetFormattedData(cell_string);
 		}
 		else
 		{
@@ -550,6 +566,7 @@ void ElementDataGridRow::Load(const DataQuery& row_information)
 	}
 
 	dirty_cells = false;
+	dirty_fields.clear();
 }
 
 // Instantiates the children that haven't been fully loaded yet.
@@ -652,6 +669,26 @@ void ElementDataGridRow::LoadChildren(int first_row_to_load, int num_rows_to_loa
 
 void ElementDataGridRow::DirtyCells()
 {
+	dirty_cells = true;
+	dirty_fields.clear();
+	if (parent_row)
+	{
+		parent_row->DirtyRow();
+	}
+}
+
+void ElementDataGridRow::DirtyCells(const Rml::Core::StringList& changed_fields)
+{
+	// If the whole row is already dirty, there is nothing to add.
+	if (dirty_cells && dirty_fields.empty())
+		return;
+
+	for (const Rml::Core::String& field : changed_fields)
+	{
+		if (std::find(dirty_fields.begin(), dirty_fields.end(), field) == dirty_fields.end())
+			dirty_fields.push_back(field);
+	}
+
 	dirty_cells = true;
 	if (parent_row)
 	{
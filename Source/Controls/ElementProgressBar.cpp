@@ -239,6 +239,10 @@ void ElementProgressBar::GenerateGeometry()
 		texcoords[1] = Vector2f(1, 1);
 	}
 
+	// Map the coordinates into the texture atlas, if the image is packed into one.
+	for (Vector2f& texcoord : texcoords)
+		texcoord = texture.MapTexCoord(GetRenderInterface(), texcoord);
+
 	Core::Colourb quad_colour;
 	{
 		const Core::ComputedValues& computed = GetComputedValues();
@@ -0,0 +1,303 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../Include/RmlUi/Controls/ElementVirtualList.h"
+#include "../../Include/RmlUi/Controls/DataFormatter.h"
+#include "../../Include/RmlUi/Controls/DataSource.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Property.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "RowWindow.h"
+#include <algorithm>
+
+namespace Rml {
+namespace Controls {
+
+ElementVirtualList::ElementVirtualList(const Rml::Core::String& tag) : Core::Element(tag)
+{
+	data_source = nullptr;
+	data_formatter = nullptr;
+
+	window = std::make_unique< RowWindow >(this,
+		[this]() { return Core::Factory::InstanceElement(this, "*", "listrow", Core::XMLAttributes()); },
+		[this](Core::Element* row, int index) { FormatRow(row, index); }
+	);
+	num_rows = 0;
+
+	initialised = false;
+}
+
+ElementVirtualList::~ElementVirtualList()
+{
+	if (data_source != nullptr)
+	{
+		data_source->DetachListener(this);
+		data_source = nullptr;
+	}
+}
+
+// Sets the data source the list's rows are driven from.
+void ElementVirtualList::SetDataSource(const Rml::Core::String& _data_source)
+{
+	SetAttribute("source", _data_source);
+}
+
+// Sets the RML template used to generate each row.
+void ElementVirtualList::SetRowTemplate(const Rml::Core::String& rml)
+{
+	row_template = rml;
+	window->SetDirty();
+}
+
+// Returns the number of rows in the list.
+int ElementVirtualList::GetNumRows() const
+{
+	return num_rows;
+}
+
+// Returns the element of one of the list's rows, if it is currently instanced.
+Core::Element* ElementVirtualList::GetRow(int index) const
+{
+	return window->GetRow(index);
+}
+
+// Returns the number of rows currently instanced as elements.
+int ElementVirtualList::GetNumInstancedRows() const
+{
+	return (int)window->GetRows().size();
+}
+
+// Scrolls the list so that the given row is at the top of the client area.
+void ElementVirtualList::ScrollToRow(int index)
+{
+	SetScrollTop((float)index * window->GetRowHeight());
+}
+
+// Attaches to the data source if necessary, and instances the rows visible at the current scroll position.
+void ElementVirtualList::OnUpdate()
+{
+	if (!initialised)
+	{
+		initialised = true;
+
+		// The contents of the element, as given in the document, act as the row template.
+		if (!window->HasSpacers())
+		{
+			if (row_template.empty())
+				GetInnerRML(row_template);
+
+			while (Core::Element* child = GetFirstChild())
+				RemoveChild(child);
+
+			Core::ElementPtr spacer = Core::Factory::InstanceElement(this, "*", "listspacer", Core::XMLAttributes());
+			spacer->SetProperty(Core::PropertyId::Display, Core::Property(Core::Style::Display::Block));
+			Core::Element* top_spacer = AppendChild(std::move(spacer));
+
+			spacer = Core::Factory::InstanceElement(this, "*", "listspacer", Core::XMLAttributes());
+			spacer->SetProperty(Core::PropertyId::Display, Core::Property(Core::Style::Display::Block));
+			Core::Element* bottom_spacer = AppendChild(std::move(spacer));
+
+			window->SetSpacers(top_spacer, bottom_spacer);
+		}
+
+		ParseAttributes();
+
+		if (ParseDataSource(data_source, data_table, GetAttribute< Rml::Core::String >("source", "")))
+			data_source->AttachListener(this);
+
+		window->SetDirty();
+	}
+
+	UpdateRows();
+}
+
+// Checks for changes to the data source or formatting attributes.
+void ElementVirtualList::OnAttributeChange(const Core::ElementAttributes& changed_attributes)
+{
+	Core::Element::OnAttributeChange(changed_attributes);
+
+	if (changed_attributes.find("source") != changed_attributes.end())
+	{
+		if (data_source != nullptr)
+		{
+			data_source->DetachListener(this);
+			data_source = nullptr;
+		}
+
+		initialised = false;
+	}
+	else if (changed_attributes.find("fields") != changed_attributes.end() ||
+			 changed_attributes.find("formatter") != changed_attributes.end() ||
+			 changed_attributes.find("row-height") != changed_attributes.end() ||
+			 changed_attributes.find("overscan") != changed_attributes.end())
+	{
+		ParseAttributes();
+		window->SetDirty();
+	}
+}
+
+// Detaches from the data source and clears the rows.
+void ElementVirtualList::OnDataSourceDestroy(DataSource* _data_source)
+{
+	if (data_source == _data_source)
+	{
+		data_source->DetachListener(this);
+		data_source = nullptr;
+		data_table = "";
+
+		window->SetDirty();
+	}
+}
+
+// Refreshes the instanced rows.
+void ElementVirtualList::OnRowAdd(DataSource* RMLUI_UNUSED_PARAMETER(data_source), const Rml::Core::String& table, int RMLUI_UNUSED_PARAMETER(first_row_added), int RMLUI_UNUSED_PARAMETER(num_rows_added))
+{
+	RMLUI_UNUSED(data_source);
+	RMLUI_UNUSED(first_row_added);
+	RMLUI_UNUSED(num_rows_added);
+
+	if (table == data_table)
+		window->SetDirty();
+}
+
+// Refreshes the instanced rows.
+void ElementVirtualList::OnRowRemove(DataSource* RMLUI_UNUSED_PARAMETER(data_source), const Rml::Core::String& table, int RMLUI_UNUSED_PARAMETER(first_row_removed), int RMLUI_UNUSED_PARAMETER(num_rows_removed))
+{
+	RMLUI_UNUSED(data_source);
+	RMLUI_UNUSED(first_row_removed);
+	RMLUI_UNUSED(num_rows_removed);
+
+	if (table == data_table)
+		window->SetDirty();
+}
+
+// Refreshes any instanced rows within the changed range.
+void ElementVirtualList::OnRowChange(DataSource* RMLUI_UNUSED_PARAMETER(data_source), const Rml::Core::String& table, int first_row_changed, int num_rows_changed)
+{
+	RMLUI_UNUSED(data_source);
+
+	if (table != data_table)
+		return;
+
+	const int first_row = window->GetFirstRow();
+	const std::vector< Core::Element* >& rows = window->GetRows();
+	for (int i = Core::Math::Max(first_row_changed, first_row); i < Core::Math::Min(first_row_changed + num_rows_changed, first_row + (int)rows.size()); i++)
+		FormatRow(rows[i - first_row], i);
+}
+
+// Refreshes the instanced rows.
+void ElementVirtualList::OnRowChange(DataSource* RMLUI_UNUSED_PARAMETER(data_source), const Rml::Core::String& table)
+{
+	RMLUI_UNUSED(data_source);
+
+	if (table == data_table)
+		window->SetDirty();
+}
+
+// Instances, recycles and formats rows to cover the current scroll position.
+void ElementVirtualList::UpdateRows()
+{
+	if (window->IsDirty())
+		num_rows = (data_source ? data_source->GetNumRows(data_table) : 0);
+
+	window->Update(num_rows, GetScrollTop(), GetClientHeight());
+}
+
+// Generates the contents of a row element from the data source.
+void ElementVirtualList::FormatRow(Core::Element* row, int index)
+{
+	row->SetAttribute("index", index);
+
+	Rml::Core::StringList row_data;
+	if (data_source)
+		data_source->GetRow(row_data, data_table, index, fields);
+
+	Rml::Core::String rml;
+	if (data_formatter)
+	{
+		data_formatter->FormatData(rml, row_data);
+	}
+	else if (!row_template.empty())
+	{
+		// Substitute the fields in a single pass, so that values are never substituted again, and encode them so that
+		// they are displayed as text rather than parsed as markup.
+		size_t position = 0;
+		for (size_t begin = row_template.find("{{"); begin != Rml::Core::String::npos; begin = row_template.find("{{", position))
+		{
+			const size_t end = row_template.find("}}", begin + 2);
+			if (end == Rml::Core::String::npos)
+				break;
+
+			auto it_field = std::find(fields.begin(), fields.end(), row_template.substr(begin + 2, end - begin - 2));
+			const size_t field_index = (size_t)(it_field - fields.begin());
+			if (field_index >= fields.size() || field_index >= row_data.size())
+			{
+				rml.append(row_template, position, begin + 2 - position);
+				position = begin + 2;
+				continue;
+			}
+
+			rml.append(row_template, position, begin - position);
+			rml += Rml::Core::StringUtilities::EncodeRml(row_data[field_index]);
+			position = end + 2;
+		}
+
+		rml.append(row_template, position, Rml::Core::String::npos);
+	}
+	else if (!row_data.empty())
+	{
+		rml = row_data[0];
+	}
+
+	// Recycled rows usually hold the same structure as before, so only the differences need to be applied.
+	row->PatchInnerRML(rml);
+}
+
+// Parses the formatting attributes.
+void ElementVirtualList::ParseAttributes()
+{
+	fields.clear();
+	Rml::Core::StringUtilities::ExpandString(fields, GetAttribute< Rml::Core::String >("fields", ""));
+
+	data_formatter = nullptr;
+	Rml::Core::String data_formatter_attribute = GetAttribute< Rml::Core::String >("formatter", "");
+	if (!data_formatter_attribute.empty())
+	{
+		data_formatter = DataFormatter::GetDataFormatter(data_formatter_attribute);
+		if (!data_formatter)
+			Core::Log::Message(Rml::Core::Log::LT_WARNING, "Unable to find data formatter named '%s', formatting skipped.", data_formatter_attribute.c_str());
+	}
+
+	window->SetFixedRowHeight(GetAttribute< float >("row-height", 0.0f));
+	window->SetOverscan(GetAttribute< int >("overscan", 4));
+}
+
+}
+}
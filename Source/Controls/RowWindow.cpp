@@ -0,0 +1,249 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "RowWindow.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include "../../Include/RmlUi/Core/Property.h"
+#include <cmath>
+
+namespace Rml {
+namespace Controls {
+
+RowWindow::RowWindow(Core::Element* _element, InstanceRowFunction _instance_row, FormatRowFunction _format_row) : element(_element), instance_row(std::move(_instance_row)), format_row(std::move(_format_row))
+{
+	top_spacer = nullptr;
+	bottom_spacer = nullptr;
+
+	fixed_row_height = 0;
+	measured_row_height = 0;
+	overscan = 4;
+
+	first_row = 0;
+
+	last_num_rows = 0;
+	last_visible_top = -1;
+	last_visible_height = -1;
+	last_row_height = -1;
+
+	dirty = true;
+}
+
+RowWindow::~RowWindow()
+{
+}
+
+// Sets the elements the rows are placed between.
+void RowWindow::SetSpacers(Core::Element* _top_spacer, Core::Element* _bottom_spacer)
+{
+	top_spacer = _top_spacer;
+	bottom_spacer = _bottom_spacer;
+	dirty = true;
+}
+
+// Returns true if the spacers have been set.
+bool RowWindow::HasSpacers() const
+{
+	return top_spacer != nullptr;
+}
+
+// Sets the height of every row, or zero to measure the rows.
+void RowWindow::SetFixedRowHeight(float _fixed_row_height)
+{
+	fixed_row_height = _fixed_row_height;
+}
+
+// Sets the number of rows instanced beyond each side of the visible area.
+void RowWindow::SetOverscan(int _overscan)
+{
+	overscan = Core::Math::Max(_overscan, 0);
+}
+
+// Marks every instanced row to be formatted again on the next update.
+void RowWindow::SetDirty()
+{
+	dirty = true;
+}
+
+// Returns true if the rows are to be formatted again on the next update.
+bool RowWindow::IsDirty() const
+{
+	return dirty;
+}
+
+// Instances, recycles and formats the rows to cover the visible area.
+bool RowWindow::Update(int num_rows, float visible_top, float visible_height)
+{
+	if (!top_spacer)
+		return false;
+
+	MeasureRows();
+	const float row_height = GetRowHeight();
+
+	const int new_first_row = Core::Math::Clamp((int)(visible_top / row_height) - overscan, 0, num_rows);
+	const int new_last_row = Core::Math::Clamp((int)std::ceil((visible_top + visible_height) / row_height) + overscan, new_first_row, num_rows);
+
+	// The spacers need to be resized when the row height changes, such as when the first rows are measured.
+	if (!dirty && new_first_row == first_row && new_last_row == first_row + (int)rows.size() && num_rows == last_num_rows &&
+		visible_top == last_visible_top && visible_height == last_visible_height && row_height == last_row_height)
+		return false;
+
+	last_num_rows = num_rows;
+	last_visible_top = visible_top;
+	last_visible_height = visible_height;
+	last_row_height = row_height;
+
+	Core::Element* parent = bottom_spacer->GetParentNode();
+
+	// Keep the rows which are still in range, and recycle the rest.
+	std::vector< Core::Element* > new_rows(new_last_row - new_first_row, nullptr);
+	for (int i = 0; i < (int)rows.size(); i++)
+	{
+		const int index = first_row + i;
+		if (index >= new_first_row && index < new_last_row)
+			new_rows[index - new_first_row] = rows[i];
+		else
+			recycled_rows.push_back(parent->RemoveChild(rows[i]));
+	}
+
+	// Instance the newly visible rows in order, each one placed before the row following it.
+	bool any_rows_formatted = false;
+	Core::Element* next_row = bottom_spacer;
+	for (int i = (int)new_rows.size() - 1; i >= 0; i--)
+	{
+		if (!new_rows[i])
+		{
+			Core::ElementPtr row;
+			if (!recycled_rows.empty())
+			{
+				row = std::move(recycled_rows.back());
+				recycled_rows.pop_back();
+			}
+			else
+				row = instance_row();
+
+			format_row(row.get(), new_first_row + i);
+			new_rows[i] = parent->InsertBefore(std::move(row), next_row);
+			any_rows_formatted = true;
+		}
+		else if (dirty)
+		{
+			format_row(new_rows[i], new_first_row + i);
+			any_rows_formatted = true;
+		}
+
+		next_row = new_rows[i];
+	}
+
+	rows = std::move(new_rows);
+	first_row = new_first_row;
+	dirty = false;
+
+	// Let the spacers take the place of the rows which are not instanced.
+	top_spacer->SetProperty(Core::PropertyId::Height, Core::Property((float)first_row * row_height, Core::Property::PX));
+	bottom_spacer->SetProperty(Core::PropertyId::Height, Core::Property((float)(num_rows - (first_row + (int)rows.size())) * row_height, Core::Property::PX));
+
+	return any_rows_formatted;
+}
+
+// Removes all instanced rows.
+void RowWindow::Clear(bool recycle)
+{
+	if (!rows.empty())
+	{
+		Core::Element* parent = bottom_spacer->GetParentNode();
+		for (Core::Element* row : rows)
+		{
+			Core::ElementPtr row_element = parent->RemoveChild(row);
+			if (recycle)
+				recycled_rows.push_back(std::move(row_element));
+		}
+	}
+
+	rows.clear();
+	if (!recycle)
+		recycled_rows.clear();
+
+	dirty = true;
+}
+
+// Returns the height used to estimate the position of rows that are not instanced.
+float RowWindow::GetRowHeight() const
+{
+	if (fixed_row_height > 0)
+		return fixed_row_height;
+	if (measured_row_height > 0)
+		return measured_row_height;
+
+	return Core::Math::Max(element->GetLineHeight(), 1.0f);
+}
+
+// Returns the index of the first instanced row.
+int RowWindow::GetFirstRow() const
+{
+	return first_row;
+}
+
+// Returns the instanced rows.
+const std::vector< Core::Element* >& RowWindow::GetRows() const
+{
+	return rows;
+}
+
+// Returns the element of a row, or nullptr if it is not instanced.
+Core::Element* RowWindow::GetRow(int index) const
+{
+	if (index < first_row || index >= first_row + (int)rows.size())
+		return nullptr;
+
+	return rows[index - first_row];
+}
+
+// Updates the row height measured from the instanced rows, averaged over the rows laid out since the last update.
+void RowWindow::MeasureRows()
+{
+	if (fixed_row_height > 0 || rows.empty())
+		return;
+
+	float total_height = 0;
+	int num_measured = 0;
+	for (Core::Element* row : rows)
+	{
+		const float height = row->GetBox().GetSize(Core::Box::MARGIN).y;
+		if (height > 0)
+		{
+			total_height += height;
+			num_measured++;
+		}
+	}
+
+	if (num_measured > 0)
+		measured_row_height = total_height / (float)num_measured;
+}
+
+}
+}
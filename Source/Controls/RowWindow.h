@@ -0,0 +1,129 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICONTROLSROWWINDOW_H
+#define RMLUICONTROLSROWWINDOW_H
+
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <functional>
+
+namespace Rml {
+namespace Controls {
+
+/**
+	Keeps elements instanced only for the rows visible within the client area of a scrolling element, for controls
+	displaying a large number of rows. The instanced rows are placed between two spacer elements, which are sized to
+	take the place of the rows that are not instanced. Rows scrolled out of view are recycled for the rows scrolled
+	into view.
+ */
+
+class RowWindow
+{
+public:
+	/// Instances a new row element.
+	using InstanceRowFunction = std::function< Core::ElementPtr() >;
+	/// Fills in the row element placed at the given row index.
+	using FormatRowFunction = std::function< void(Core::Element* row, int index) >;
+
+	/// Constructs the row window of an element.
+	/// @param[in] element The element the rows are displayed in, its line height is used to estimate unmeasured rows.
+	/// @param[in] instance_row The function instancing new row elements.
+	/// @param[in] format_row The function filling in the rows placed in the window.
+	RowWindow(Core::Element* element, InstanceRowFunction instance_row, FormatRowFunction format_row);
+	~RowWindow();
+
+	/// Sets the elements the rows are placed between. The spacers must be siblings, the top spacer before the bottom one.
+	void SetSpacers(Core::Element* top_spacer, Core::Element* bottom_spacer);
+	/// Returns true if the spacers have been set.
+	bool HasSpacers() const;
+
+	/// Sets the height of every row, or zero to estimate it from the measured height of the instanced rows.
+	void SetFixedRowHeight(float fixed_row_height);
+	/// Sets the number of rows instanced beyond each side of the visible area.
+	void SetOverscan(int overscan);
+
+	/// Marks every instanced row to be formatted again on the next update.
+	void SetDirty();
+	/// Returns true if the rows are to be formatted again on the next update.
+	bool IsDirty() const;
+
+	/// Instances, recycles and formats the rows to cover the visible area.
+	/// @param[in] num_rows The total number of rows.
+	/// @param[in] visible_top The offset of the visible area from the top spacer.
+	/// @param[in] visible_height The height of the visible area.
+	/// @return True if any rows were formatted.
+	bool Update(int num_rows, float visible_top, float visible_height);
+
+	/// Removes all instanced rows.
+	/// @param[in] recycle True to keep the row elements for reuse, false to destroy them.
+	void Clear(bool recycle);
+
+	/// Returns the height used to estimate the position of rows that are not instanced.
+	float GetRowHeight() const;
+	/// Returns the index of the first instanced row.
+	int GetFirstRow() const;
+	/// Returns the instanced rows, starting at the first instanced row.
+	const std::vector< Core::Element* >& GetRows() const;
+	/// Returns the element of a row, or nullptr if it is not instanced.
+	Core::Element* GetRow(int index) const;
+
+private:
+	// Updates the row height measured from the instanced rows, unless a fixed height is given.
+	void MeasureRows();
+
+	Core::Element* element;
+	InstanceRowFunction instance_row;
+	FormatRowFunction format_row;
+
+	Core::Element* top_spacer;
+	Core::Element* bottom_spacer;
+
+	float fixed_row_height;
+	float measured_row_height;
+	int overscan;
+
+	// The instanced rows, starting at index 'first_row'.
+	int first_row;
+	std::vector< Core::Element* > rows;
+	// Row elements ready to be reused.
+	std::vector< Core::ElementPtr > recycled_rows;
+
+	// The number of rows, visible area and row height the rows and spacers were last updated for.
+	int last_num_rows;
+	float last_visible_top;
+	float last_visible_height;
+	float last_row_height;
+
+	bool dirty;
+};
+
+}
+}
+
+#endif
@@ -36,10 +36,14 @@
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "DocumentCache.h"
+#include "DocumentLoader.h"
 #include "EventDispatcher.h"
 #include "EventIterators.h"
+#include "LayoutScheduler.h"
 #include "PluginRegistry.h"
-#include "StreamFile.h"
+#include "TextureDatabase.h"
+#include "XMLNodeTree.h"
 #include <algorithm>
 #include <iterator>
 
@@ -167,14 +171,27 @@ bool Context::Update()
 {
 	RMLUI_ZoneScoped;
 
+	// Atlas pages are regenerated here rather than while rendering, as the previous frame is complete at this point.
+	TextureDatabase::UpdateTextureAtlas();
+
+	CompleteDocumentLoads();
+
+	for (auto& pair : data_models)
+		pair.second->Update();
+
 	root->Update(density_independent_pixel_ratio);
 
+	std::vector< ElementDocument* > documents;
+	documents.reserve(root->GetNumChildren());
 	for (int i = 0; i < root->GetNumChildren(); ++i)
 		if (auto doc = root->GetChild(i)->GetOwnerDocument())
-		{
-			doc->UpdateLayout();
-			doc->UpdatePosition();
-		}
+			documents.push_back(doc);
+
+	// Documents are laid out independently of each other, possibly in parallel.
+	LayoutScheduler::UpdateLayout(documents);
+
+	for (ElementDocument* doc : documents)
+		doc->UpdatePosition();
 
 	// Release any documents that were unloaded during the update.
 	ReleaseUnloadedDocuments();
@@ -241,14 +258,16 @@ ElementDocument* Context::CreateDocument(const String& tag)
 // Load a document into the context.
 ElementDocument* Context::LoadDocument(const String& document_path)
 {	
-	auto stream = std::make_unique<StreamFile>();
-
-	if (!stream->Open(document_path))
+	// Files are only read and parsed on their first load, later loads are instanced from the cached nodes.
+	SharedPtr<const XMLNodeTree> node_tree = DocumentCache::LoadDocument(document_path);
+	if (!node_tree)
 		return nullptr;
 
-	ElementDocument* document = LoadDocument(stream.get());
+	PluginRegistry::NotifyDocumentOpen(this, node_tree->GetSourceURL().GetURL());
 
-	return document;
+	ElementPtr element = Factory::InstanceDocumentNodeTree(this, *node_tree);
+
+	return AddLoadedDocument(std::move(element));
 }
 
 // Load a document into the context.
@@ -257,6 +276,61 @@ ElementDocument* Context::LoadDocument(Stream* stream)
 	PluginRegistry::NotifyDocumentOpen(this, stream->GetSourceURL().GetURL());
 
 	ElementPtr element = Factory::InstanceDocumentStream(this, stream);
+
+	return AddLoadedDocument(std::move(element));
+}
+
+// Load a document into the context in the background.
+SharedPtr<AsyncDocumentLoad> Context::LoadDocumentAsync(const String& document_path, AsyncDocumentCallback callback)
+{
+	auto load = std::make_shared<AsyncDocumentLoad>(document_path, std::move(callback));
+	pending_document_loads.push_back(load);
+
+	DocumentLoader::Enqueue(load);
+
+	return load;
+}
+
+void Context::CompleteDocumentLoads()
+{
+	// Complete the loads in order, a single loader thread prepares them in the same order.
+	size_t num_completed = 0;
+	for (; num_completed < pending_document_loads.size(); num_completed++)
+	{
+		AsyncDocumentLoad& load = *pending_document_loads[num_completed];
+		if (!load.prepared)
+			break;
+
+		if (load.node_tree)
+		{
+			PluginRegistry::NotifyDocumentOpen(this, load.node_tree->GetSourceURL().GetURL());
+
+			ElementPtr element = Factory::InstanceDocumentNodeTree(this, *load.node_tree, load.style_sheet);
+			load.document = AddLoadedDocument(std::move(element));
+		}
+
+		load.node_tree.reset();
+		load.style_sheet.reset();
+		load.complete = true;
+	}
+
+	if (num_completed == 0)
+		return;
+
+	// Move the completed loads out before calling back, the callbacks may request new loads.
+	std::vector< SharedPtr<AsyncDocumentLoad> > completed_loads(pending_document_loads.begin(), pending_document_loads.begin() + num_completed);
+	pending_document_loads.erase(pending_document_loads.begin(), pending_document_loads.begin() + num_completed);
+
+	for (const SharedPtr<AsyncDocumentLoad>& load : completed_loads)
+	{
+		if (load->callback)
+			load->callback(load->document);
+	}
+}
+
+// Attaches a newly instanced document to the context and fires its load events.
+ElementDocument* Context::AddLoadedDocument(ElementPtr element)
+{
 	if (!element)
 		return nullptr;
 
@@ -399,6 +473,33 @@ int Context::GetNumDocuments() const
 	return root->GetNumChildren();
 }
 
+DataModel* Context::CreateDataModel(const String& model_name)
+{
+	auto result = data_models.emplace(model_name, nullptr);
+	if (!result.second)
+	{
+		Log::Message(Log::LT_WARNING, "Data model '%s' already exists in context '%s'.", model_name.c_str(), name.c_str());
+		return nullptr;
+	}
+
+	result.first->second = std::make_unique<DataModel>(model_name);
+	return result.first->second.get();
+}
+
+DataModel* Context::GetDataModel(const String& model_name)
+{
+	auto it = data_models.find(model_name);
+	if (it == data_models.end())
+		return nullptr;
+
+	return it->second.get();
+}
+
+bool Context::RemoveDataModel(const String& model_name)
+{
+	return data_models.erase(model_name) > 0;
+}
+
 // Returns the hover element.
 Element* Context::GetHoverElement()
 {
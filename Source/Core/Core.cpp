@@ -35,11 +35,17 @@
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "../../Include/RmlUi/Core/Texture.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
+#include "DocumentCache.h"
+#include "DocumentLoader.h"
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
 #include "GeometryDatabase.h"
+#include "LayoutArena.h"
+#include "LayoutBlockBox.h"
+#include "LayoutScheduler.h"
 #include "PluginRegistry.h"
 #include "StyleSheetFactory.h"
 #include "TemplateCache.h"
@@ -118,6 +124,7 @@ bool Initialise()
 	StyleSheetFactory::Initialise();
 
 	TemplateCache::Initialise();
+	DocumentCache::Initialise();
 
 	Factory::Initialise();
 
@@ -134,9 +141,13 @@ void Shutdown()
 	// Clear out all contexts, which should also clean up all attached elements.
 	contexts.clear();
 
+	LayoutScheduler::Shutdown();
+	DocumentLoader::Shutdown();
+
 	// Notify all plugins we're being shutdown.
 	PluginRegistry::NotifyShutdown();
 
+	DocumentCache::Shutdown();
 	TemplateCache::Shutdown();
 	StyleSheetFactory::Shutdown();
 	StyleSheetSpecification::Shutdown();
@@ -328,10 +339,40 @@ void ReleaseTextures()
 	TextureDatabase::ReleaseTextures();
 }
 
+void SetTextureMemoryBudget(size_t budget_bytes)
+{
+	TextureDatabase::SetMemoryBudget(budget_bytes);
+}
+
+TextureMemoryStatistics GetTextureMemoryStatistics()
+{
+	return TextureDatabase::GetMemoryStatistics();
+}
+
+void SetTextureAtlas(int max_image_dimensions, int page_dimensions)
+{
+	TextureDatabase::SetTextureAtlas(max_image_dimensions, page_dimensions);
+}
+
 void ReleaseCompiledGeometry()
 {
 	return GeometryDatabase::ReleaseAll();
 }
 
+int GetNumLayoutRestarts()
+{
+	return LayoutBlockBox::GetNumRestarts();
+}
+
+LayoutMemoryStatistics GetLayoutMemoryStatistics()
+{
+	return LayoutArena::GetStatistics();
+}
+
+void SetLayoutThreads(int num_threads)
+{
+	LayoutScheduler::SetNumThreads(Math::Max(num_threads, 0));
+}
+
 }
 }
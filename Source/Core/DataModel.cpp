@@ -0,0 +1,396 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../Include/RmlUi/Core/DataModel.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include <algorithm>
+
+namespace Rml {
+namespace Core {
+
+static const String attribute_binding_prefix = "data-attr-";
+
+// Tags of the elements whose contents are excluded from binding.
+static UnorderedSet< String > template_tags;
+
+DataModel::DataModel(const String& name) : name(name), variables_dirty(false), sweep_size(64), update_generation(0)
+{
+}
+
+DataModel::~DataModel()
+{
+}
+
+const String& DataModel::GetName() const
+{
+	return name;
+}
+
+bool DataModel::BindGetter(const String& variable_name, DataGetFunc getter)
+{
+	Variable& variable = variables[GetVariableIndex(variable_name)];
+	if (variable.getter)
+	{
+		Log::Message(Log::LT_WARNING, "Data variable '%s' has already been bound in data model '%s'.", variable_name.c_str(), name.c_str());
+		return false;
+	}
+
+	// The variable may already be referenced by bindings made before it was bound.
+	variable.getter = std::move(getter);
+	variable.dirty = true;
+	variables_dirty = true;
+
+	return true;
+}
+
+void DataModel::DirtyVariable(const String& variable_name)
+{
+	auto it = variable_indices.find(variable_name);
+	if (it == variable_indices.end())
+		return;
+
+	variables[it->second].dirty = true;
+	variables_dirty = true;
+}
+
+void DataModel::DirtyAllVariables()
+{
+	for (Variable& variable : variables)
+		variable.dirty = true;
+
+	variables_dirty = !variables.empty();
+}
+
+bool DataModel::IsVariableDirty(const String& variable_name) const
+{
+	auto it = variable_indices.find(variable_name);
+	return it != variable_indices.end() && variables[it->second].dirty;
+}
+
+void DataModel::RegisterTemplateTag(const String& tag)
+{
+	template_tags.insert(StringUtilities::ToLower(tag));
+}
+
+DataModel* DataModel::GetModelInScope(Element* parent, Element* element)
+{
+	// The element isn't attached to its parent yet, so the context and the ancestors are found through the parent.
+	Context* context = (parent ? parent->GetContext() : nullptr);
+	if (!context)
+		return nullptr;
+
+	for (Element* scope = (element ? element : parent); scope; scope = (scope == element ? parent : scope->GetParentNode()))
+	{
+		// The element itself may be a template element, only its contents are excluded.
+		if (scope != element && !template_tags.empty() && template_tags.count(scope->GetTagName()) > 0)
+			return nullptr;
+
+		if (const Variant* model_name = scope->GetAttribute("data-model"))
+		{
+			const String name = model_name->Get< String >();
+
+			DataModel* model = context->GetDataModel(name);
+			if (!model)
+				Log::Message(Log::LT_WARNING, "Could not find data model '%s' of element %s.", name.c_str(), scope->GetAddress().c_str());
+
+			return model;
+		}
+	}
+
+	return nullptr;
+}
+
+void DataModel::BindText(Element* parent, ElementText* text_element, const String& text)
+{
+	if (text.find("{{") == String::npos)
+		return;
+
+	DataModel* model = GetModelInScope(parent);
+	if (!model)
+		return;
+
+	std::vector< Segment > segments;
+	if (model->ParseSegments(text, segments))
+		model->AddBinding(text_element, String(), text, std::move(segments));
+}
+
+void DataModel::BindAttributes(Element* parent, Element* element)
+{
+	// Binding sets the attributes, so collect the bound ones first.
+	std::vector< std::pair< String, String > > bound_attributes;
+	for (auto& pair : element->GetAttributes())
+	{
+		const String& attribute_name = pair.first;
+		if (attribute_name.size() > attribute_binding_prefix.size() && attribute_name.compare(0, attribute_binding_prefix.size(), attribute_binding_prefix) == 0)
+			bound_attributes.emplace_back(attribute_name, pair.second.Get< String >());
+	}
+
+	if (bound_attributes.empty())
+		return;
+
+	DataModel* model = GetModelInScope(parent, element);
+	if (!model)
+		return;
+
+	for (auto& pair : bound_attributes)
+	{
+		const String& attribute_name = pair.first;
+		const String& value = pair.second;
+
+		// The value is either a variable name, or text referencing variables.
+		std::vector< Segment > segments;
+		if (value.find("{{") == String::npos)
+		{
+			const String variable_name = StringUtilities::StripWhitespace(value);
+			if (!variable_name.empty())
+				segments.push_back(Segment{ String(), model->GetVariableIndex(variable_name) });
+		}
+		else
+		{
+			model->ParseSegments(value, segments);
+		}
+
+		if (segments.empty())
+		{
+			Log::Message(Log::LT_WARNING, "No data variable given for attribute '%s' on element %s.", attribute_name.c_str(), element->GetAddress().c_str());
+			continue;
+		}
+
+		const String attribute = attribute_name.substr(attribute_binding_prefix.size());
+		model->AddBinding(element, attribute, element->GetAttribute< String >(attribute, String()), std::move(segments));
+	}
+}
+
+void DataModel::BindElementTree(Element* element)
+{
+	Element* parent = element->GetParentNode();
+
+	BindAttributes(parent, element);
+	if (ElementText* text_element = rmlui_dynamic_cast< ElementText* >(element))
+		BindText(parent, text_element, text_element->GetText());
+
+	for (int i = 0; i < element->GetNumChildren(); i++)
+		BindElementTree(element->GetChild(i));
+}
+
+int DataModel::GetVariableIndex(const String& variable_name)
+{
+	auto it = variable_indices.find(variable_name);
+	if (it != variable_indices.end())
+		return it->second;
+
+	const int index = (int)variables.size();
+	variables.emplace_back();
+	variable_indices.emplace(variable_name, index);
+
+	return index;
+}
+
+bool DataModel::ParseSegments(const String& text, std::vector< Segment >& segments)
+{
+	bool any_variables = false;
+	size_t position = 0;
+
+	for (size_t begin = text.find("{{"); begin != String::npos; begin = text.find("{{", begin + 2))
+	{
+		const size_t end = text.find("}}", begin + 2);
+		if (end == String::npos)
+			break;
+
+		const String variable_name = StringUtilities::StripWhitespace(StringView(text.data() + begin + 2, text.data() + end));
+		if (variable_name.empty())
+			continue;
+
+		if (begin > position)
+			segments.push_back(Segment{ text.substr(position, begin - position), -1 });
+		segments.push_back(Segment{ String(), GetVariableIndex(variable_name) });
+
+		any_variables = true;
+		position = end + 2;
+		begin = end;
+	}
+
+	if (position < text.size())
+		segments.push_back(Segment{ text.substr(position), -1 });
+
+	return any_variables;
+}
+
+void DataModel::AddBinding(Element* element, const String& attribute, const String& current_value, std::vector< Segment >&& segments)
+{
+	if (free_bindings.empty() && bindings.size() >= sweep_size)
+	{
+		SweepBindings();
+		sweep_size = std::max(sweep_size, 2 * (bindings.size() - free_bindings.size()));
+	}
+
+	int index = 0;
+	if (free_bindings.empty())
+	{
+		index = (int)bindings.size();
+		bindings.emplace_back();
+	}
+	else
+	{
+		index = free_bindings.back();
+		free_bindings.pop_back();
+	}
+
+	Binding& binding = bindings[index];
+	binding.element = element->GetObserverPtr();
+	binding.attribute = attribute;
+	binding.segments = std::move(segments);
+	binding.update_generation = update_generation;
+	binding.active = true;
+
+	for (const Segment& segment : binding.segments)
+	{
+		if (segment.variable >= 0)
+		{
+			std::vector< int >& variable_bindings = variables[segment.variable].bindings;
+			if (std::find(variable_bindings.begin(), variable_bindings.end(), index) == variable_bindings.end())
+				variable_bindings.push_back(index);
+		}
+	}
+
+	// Replace the text of the RML with the current value.
+	binding.value = current_value;
+	UpdateBinding(index);
+}
+
+void DataModel::RemoveBinding(int index)
+{
+	Binding& binding = bindings[index];
+
+	for (const Segment& segment : binding.segments)
+	{
+		if (segment.variable >= 0)
+		{
+			std::vector< int >& variable_bindings = variables[segment.variable].bindings;
+			auto it = std::find(variable_bindings.begin(), variable_bindings.end(), index);
+			if (it != variable_bindings.end())
+			{
+				*it = variable_bindings.back();
+				variable_bindings.pop_back();
+			}
+		}
+	}
+
+	binding = Binding();
+	free_bindings.push_back(index);
+}
+
+void DataModel::SweepBindings()
+{
+	for (int i = 0; i < (int)bindings.size(); i++)
+	{
+		if (bindings[i].active && !bindings[i].element)
+			RemoveBinding(i);
+	}
+}
+
+bool DataModel::UpdateBinding(int index)
+{
+	Binding& binding = bindings[index];
+
+	Element* element = binding.element.get();
+	if (!element)
+		return false;
+
+	String value;
+	Variant variable_value;
+	for (const Segment& segment : binding.segments)
+	{
+		if (segment.variable < 0)
+		{
+			value += segment.text;
+		}
+		else if (const DataGetFunc& getter = variables[segment.variable].getter)
+		{
+			variable_value.Clear();
+			getter(variable_value);
+			value += variable_value.Get< String >();
+		}
+	}
+
+	if (value == binding.value)
+		return true;
+
+	binding.value = value;
+
+	// Setting the value may call back into the model, so the binding is not used after this point.
+	if (binding.attribute.empty())
+		static_cast< ElementText* >(element)->SetText(value);
+	else
+		element->SetAttribute(String(binding.attribute), value);
+
+	return true;
+}
+
+void DataModel::Update()
+{
+	if (!variables_dirty)
+		return;
+
+	variables_dirty = false;
+	update_generation++;
+
+	// Indices are used throughout, as updating the elements may add variables and bindings.
+	for (size_t variable_index = 0; variable_index < variables.size(); variable_index++)
+	{
+		if (!variables[variable_index].dirty)
+			continue;
+
+		variables[variable_index].dirty = false;
+
+		// Each binding is updated once, even when several of its variables have changed.
+		for (size_t i = 0; i < variables[variable_index].bindings.size();)
+		{
+			const int binding_index = variables[variable_index].bindings[i];
+			if (bindings[binding_index].update_generation == update_generation)
+			{
+				i++;
+				continue;
+			}
+
+			bindings[binding_index].update_generation = update_generation;
+
+			if (UpdateBinding(binding_index))
+				i++;
+			else
+				RemoveBinding(binding_index);
+		}
+	}
+}
+
+}
+}
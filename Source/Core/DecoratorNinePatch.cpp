@@ -87,7 +87,7 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 	// Normalized texture coordinates [0, 1]
 	Vector2f tex_coords[4];
 	for (int i = 0; i < 4; i++)
-		tex_coords[i] = tex_pos[i] / texture_dimensions;
+		tex_coords[i] = texture->MapTexCoord(render_interface, tex_pos[i] / texture_dimensions);
 
 	// Surface position [0, surface_dimensions]
 	// Need to keep the corner patches at their native pixel size, but stretch the inner patches.
@@ -28,6 +28,7 @@
 
 #include "DecoratorTiled.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include <algorithm>
@@ -89,6 +90,10 @@ void DecoratorTiled::Tile::CalculateDimensions(Element* element, const Texture&
 
 			new_data.texcoords[0] = position / texture_dimensions;
 			new_data.texcoords[1] = size_relative + new_data.texcoords[0];
+
+			// Map the coordinates into the texture atlas, if the texture is packed into one.
+			for (Vector2f& texcoord : new_data.texcoords)
+				texcoord = texture.MapTexCoord(render_interface, texcoord);
 		}
 
 		data.emplace( render_interface, new_data );
@@ -107,7 +112,7 @@ Vector2f DecoratorTiled::Tile::GetDimensions(Element* element) const
 }
 
 // Generates geometry to render this tile across a surface.
-void DecoratorTiled::Tile::GenerateGeometry(std::vector< Vertex >& vertices, std::vector< int >& indices, Element* element, const Vector2f& surface_origin, const Vector2f& surface_dimensions, const Vector2f& tile_dimensions) const
+void DecoratorTiled::Tile::GenerateGeometry(Geometry& geometry, Element* element, const Vector2f& surface_origin, const Vector2f& surface_dimensions, const Vector2f& tile_dimensions) const
 {
 	if (surface_dimensions.x <= 0 || surface_dimensions.y <= 0)
 		return;
@@ -221,19 +226,15 @@ void DecoratorTiled::Tile::GenerateGeometry(std::vector< Vertex >& vertices, std
 	}
 
 
-	// Resize the vertex and index arrays to fit the new geometry.
-	int index_offset = (int) vertices.size();
-	vertices.resize(vertices.size() + 4);
-	Vertex* new_vertices = &vertices[0] + index_offset;
-
-	size_t num_indices = indices.size();
-	indices.resize(indices.size() + 6);
-	int* new_indices = &indices[0] + num_indices;
-
-	// Generate the vertices for the tiled surface.
-	Vector2f tile_position = (surface_origin + tile_offset).Round();
+	// Generate the quad for the tiled surface.
+	QuadInstance quad;
+	quad.position = (surface_origin + tile_offset).Round();
+	quad.size = final_tile_dimensions.Round();
+	quad.tex_coord[0] = scaled_texcoords[0];
+	quad.tex_coord[1] = scaled_texcoords[1];
+	quad.colour = quad_colour;
 
-	GeometryUtilities::GenerateQuad(new_vertices, new_indices, tile_position, final_tile_dimensions.Round(), quad_colour, scaled_texcoords[0], scaled_texcoords[1], index_offset);
+	geometry.GetQuads().push_back(quad);
 }
 
 // Scales a tile dimensions by a fixed value along one axis.
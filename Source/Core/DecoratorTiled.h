@@ -36,6 +36,7 @@
 namespace Rml {
 namespace Core {
 
+class Geometry;
 struct Texture;
 
 /**
@@ -89,13 +90,12 @@ public:
 		Vector2f GetDimensions(Element* element) const;
 
 		/// Generates geometry to render this tile across a surface.
-		/// @param[out] vertices The array to store the generated vertex data.
-		/// @param[out] indices The array to store the generated index data.
+		/// @param[out] geometry The geometry to append the generated quad to.
 		/// @param[in] element The element hosting the decorator.
 		/// @param[in] surface_origin The starting point of the first tile to generate.
 		/// @param[in] surface_dimensions The dimensions of the surface to be tiled.
 		/// @param[in] tile_dimensions The dimensions to render this tile at.
-		void GenerateGeometry(std::vector< Vertex >& vertices, std::vector< int >& indices, Element* element, const Vector2f& surface_origin, const Vector2f& surface_dimensions, const Vector2f& tile_dimensions) const;
+		void GenerateGeometry(Geometry& geometry, Element* element, const Vector2f& surface_origin, const Vector2f& surface_dimensions, const Vector2f& tile_dimensions) const;
 
 		struct TileData
 		{
@@ -0,0 +1,92 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "DocumentCache.h"
+#include "StreamFile.h"
+#include "XMLNodeTree.h"
+
+namespace Rml {
+namespace Core {
+
+static DocumentCache* instance = nullptr;
+
+DocumentCache::DocumentCache()
+{
+	RMLUI_ASSERT(instance == nullptr);
+	instance = this;
+}
+
+DocumentCache::~DocumentCache()
+{
+	instance = nullptr;
+}
+
+bool DocumentCache::Initialise()
+{
+	new DocumentCache();
+
+	return true;
+}
+
+void DocumentCache::Shutdown()
+{
+	delete instance;
+}
+
+SharedPtr<const XMLNodeTree> DocumentCache::LoadDocument(const String& path)
+{
+	// Check if the document is already loaded
+	{
+		std::lock_guard<std::mutex> lock(instance->documents_mutex);
+		Documents::iterator itr = instance->documents.find(path);
+		if (itr != instance->documents.end())
+			return itr->second;
+	}
+
+	// Nope, we better load it, without holding the lock so that other documents can be fetched meanwhile
+	auto stream = std::make_unique<StreamFile>();
+	if (!stream->Open(path))
+		return nullptr;
+
+	auto node_tree = std::make_shared<XMLNodeTree>();
+	node_tree->Load(stream.get());
+
+	// Another thread may have loaded the same document in the meantime, in which case its copy is kept
+	std::lock_guard<std::mutex> lock(instance->documents_mutex);
+	return instance->documents.emplace(path, std::move(node_tree)).first->second;
+}
+
+void DocumentCache::Clear()
+{
+	// Documents currently being instanced keep their node trees alive through their own references.
+	std::lock_guard<std::mutex> lock(instance->documents_mutex);
+	instance->documents.clear();
+}
+
+}
+}
@@ -0,0 +1,73 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREDOCUMENTCACHE_H
+#define RMLUICOREDOCUMENTCACHE_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
+
+namespace Rml {
+namespace Core {
+
+class XMLNodeTree;
+
+/**
+	Manages requests for loading documents from files, caching their parsed node trees so that documents
+	loaded again can be instanced without reading and tokenizing the file.
+ */
+
+class DocumentCache
+{
+public:
+	/// Initialisation and Shutdown
+	static bool Initialise();
+	static void Shutdown();
+
+	/// Load the parsed document from the given path, if it's already loaded get the cached copy.
+	/// @return The parsed document, or nullptr if the file could not be opened.
+	static SharedPtr<const XMLNodeTree> LoadDocument(const String& path);
+
+	/// Clear the document cache.
+	static void Clear();
+
+private:
+	DocumentCache();
+	~DocumentCache();
+
+	using Documents = UnorderedMap<String, SharedPtr<const XMLNodeTree>>;
+	Documents documents;
+
+	// Guards the documents, as they may also be loaded by the document loader thread.
+	std::mutex documents_mutex;
+};
+
+}
+}
+
+#endif
@@ -34,6 +34,8 @@
 namespace Rml {
 namespace Core {
 
+class StyleSheet;
+
 using LineNumberList = std::vector<int>;
 
 /**
@@ -58,6 +60,8 @@ public:
 	LineNumberList rcss_inline_line_numbers;
 	/// External RCSS definitions that should be loaded
 	StringList rcss_external;
+	/// Style sheet built in advance from the RCSS definitions, used instead of loading them when set
+	SharedPtr<StyleSheet> prepared_style_sheet;
 
 	/// Inline script source
 	StringList scripts_inline;
@@ -0,0 +1,181 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "DocumentLoader.h"
+#include "../../Include/RmlUi/Core/AsyncDocumentLoad.h"
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "DocumentCache.h"
+#include "DocumentHeader.h"
+#include "StyleSheetFactory.h"
+#include "XMLNodeTree.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+namespace Core {
+
+static std::thread worker;
+
+// Guards the queue below, the worker waits on the queue condition until a load is queued.
+static std::mutex queue_mutex;
+static std::condition_variable queue_condition;
+static std::deque< SharedPtr<AsyncDocumentLoad> > queue;
+static bool stop_worker = false;
+
+// Collects the style sheet definitions from the head of a document, following the rules of XMLNodeHandlerHead without
+// touching any element or handler state.
+class HeaderCollector : public BaseXMLParser
+{
+public:
+	DocumentHeader header;
+	bool has_templates = false;
+
+	void HandleElementStart(const String& _name, const XMLAttributes& attributes) override
+	{
+		const String name = StringUtilities::ToLower(_name);
+		tag = name;
+
+		if (name == "head")
+		{
+			in_head = true;
+		}
+		else if (in_head && name == "link")
+		{
+			String type = StringUtilities::ToLower(Get<String>(attributes, "type", ""));
+			String href = Get<String>(attributes, "href", "");
+
+			if (href.empty())
+				return;
+
+			if (type == "text/rcss" || type == "text/css")
+				header.rcss_external.push_back(href);
+			else if (type == "text/template")
+				has_templates = true;
+		}
+	}
+
+	void HandleElementEnd(const String& name) override
+	{
+		if (StringUtilities::ToLower(name) == "head")
+			in_head = false;
+		tag.clear();
+	}
+
+	void HandleData(const String& data) override
+	{
+		if (in_head && tag == "style" && data.size() > 0)
+		{
+			header.rcss_inline.push_back(data);
+			header.rcss_inline_line_numbers.push_back(GetLineNumberOpenTag());
+		}
+	}
+
+private:
+	bool in_head = false;
+	String tag;
+};
+
+void DocumentLoader::Enqueue(SharedPtr<AsyncDocumentLoad> load)
+{
+	std::lock_guard< std::mutex > lock(queue_mutex);
+
+	if (!worker.joinable())
+	{
+		stop_worker = false;
+		worker = std::thread(&DocumentLoader::RunWorker);
+	}
+
+	queue.push_back(std::move(load));
+	queue_condition.notify_one();
+}
+
+void DocumentLoader::Shutdown()
+{
+	{
+		std::lock_guard< std::mutex > lock(queue_mutex);
+		stop_worker = true;
+		queue.clear();
+	}
+	queue_condition.notify_one();
+
+	if (worker.joinable())
+		worker.join();
+}
+
+void DocumentLoader::Prepare(AsyncDocumentLoad& load)
+{
+	RMLUI_ZoneScoped;
+
+	SharedPtr<const XMLNodeTree> node_tree = DocumentCache::LoadDocument(load.path);
+
+	// Documents merging in templates have their style sheets combined with the templates' while instancing, as the
+	// template cache is only accessed from the main thread.
+	if (node_tree)
+	{
+		HeaderCollector collector;
+		collector.header.source = node_tree->GetSourceURL().GetURL();
+		node_tree->Parse(collector);
+
+		if (!collector.has_templates)
+		{
+			DocumentHeader header;
+			header.MergeHeader(collector.header);
+			load.style_sheet = StyleSheetFactory::GetDocumentStyleSheet(header, collector.header.source);
+		}
+	}
+
+	load.node_tree = std::move(node_tree);
+	load.prepared = true;
+}
+
+void DocumentLoader::RunWorker()
+{
+	std::unique_lock< std::mutex > lock(queue_mutex);
+	while (true)
+	{
+		queue_condition.wait(lock, [] { return stop_worker || !queue.empty(); });
+		if (stop_worker)
+			return;
+
+		SharedPtr<AsyncDocumentLoad> load = std::move(queue.front());
+		queue.pop_front();
+
+		lock.unlock();
+		Prepare(*load);
+		load.reset();
+		lock.lock();
+	}
+}
+
+}
+}
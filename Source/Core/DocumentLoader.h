@@ -0,0 +1,64 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREDOCUMENTLOADER_H
+#define RMLUICOREDOCUMENTLOADER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+namespace Core {
+
+class AsyncDocumentLoad;
+
+/**
+	Prepares documents loaded in the background on a worker thread. The worker reads and parses the document file into
+	the document cache, and builds the style sheet from the document header, leaving only instancing of the elements
+	for the main thread.
+ */
+
+class DocumentLoader
+{
+public:
+	/// Queues the load for preparation, starting the worker thread if it is not running.
+	/// @param[in] load The load to prepare.
+	static void Enqueue(SharedPtr<AsyncDocumentLoad> load);
+	/// Stops and joins the worker thread, discarding any loads not yet prepared.
+	static void Shutdown();
+
+private:
+	// Reads the document and builds its style sheet, then marks the load as prepared.
+	static void Prepare(AsyncDocumentLoad& load);
+	// The main loop of the worker thread.
+	static void RunWorker();
+};
+
+}
+}
+
+#endif
@@ -33,6 +33,8 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementInstancer.h"
 #include "../../Include/RmlUi/Core/ElementScroll.h"
+#include "../../Include/RmlUi/Core/ElementSelector.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Dictionary.h"
@@ -49,6 +51,7 @@
 #include "ElementBackground.h"
 #include "ElementBorder.h"
 #include "ElementDefinition.h"
+#include "ElementPatcher.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
@@ -56,10 +59,12 @@
 #include "LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "PropertiesIterator.h"
+#include "LayoutScheduler.h"
 #include "Pool.h"
 #include "StyleSheetParser.h"
 #include "XMLParseTools.h"
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 
 namespace Rml {
@@ -111,9 +116,27 @@ struct ElementMeta
 
 static Pool< ElementMeta > element_meta_chunk_pool(200, true);
 
+// The number of open batches of changes to an element's children, the invalidation deferred by them, and the added
+// children that haven't been notified yet. Added children removed during the batch are set to null.
+struct ElementBatch
+{
+	int depth = 0;
+	bool dirty_stacking_context = false;
+	bool dirty_layout = false;
+	ElementList added_children;
+};
+
+// Incremented whenever the scroll translation of any element may have changed. Elements lazily recompute their cached
+// scroll translation when this no longer matches, so that scrolling does not need to visit every descendant.
+static std::atomic< unsigned int > scroll_generation(1);
+
+// Advanced whenever a shrink-to-fit width is measured. Layout changes stamp the changed element and its ancestors with the
+// current value, so any change after a width was cached gives the element a different stamp than the one cached with.
+static std::atomic< unsigned int > layout_change_epoch(1);
+
 
 /// Constructs a new RmlUi element.
-Element::Element(const String& tag) : tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_offset(0, 0), content_offset(0, 0), content_box(0, 0), 
+Element::Element(const String& tag) : tag(tag), relative_offset_base(0, 0), relative_offset_position(0, 0), absolute_offset(0, 0), scroll_translation(0, 0), scroll_offset(0, 0), content_offset(0, 0), content_box(0, 0), 
 transform_state(), dirty_transform(false), dirty_perspective(false), dirty_animation(false), dirty_transition(false)
 {
 	RMLUI_ASSERT(tag == StringUtilities::ToLower(tag));
@@ -121,10 +144,25 @@ transform_state(), dirty_transform(false), dirty_perspective(false), dirty_anima
 	focus = nullptr;
 	instancer = nullptr;
 	owner_document = nullptr;
+	id_indexed = false;
+	dom_indexed = false;
+
+	dom_order_generation = 0;
+	dom_order_begin = 0;
+	dom_order_end = 0;
+	dom_depth = 0;
+
+	patch_fingerprint = 0;
 
 	offset_fixed = false;
 	offset_parent = nullptr;
 	offset_dirty = true;
+	scroll_translation_generation = 0;
+	layout_change_stamp = 0;
+	shrink_to_fit_width = -1;
+	shrink_to_fit_stamp = 0;
+	vertical_overflow_box = Vector2f(-1, -1);
+	vertical_overflow_stamp = 0;
 
 	client_area = Box::PADDING;
 
@@ -140,6 +178,8 @@ transform_state(), dirty_transform(false), dirty_perspective(false), dirty_anima
 
 	structure_dirty = false;
 
+	batch_added_index = -1;
+
 	computed_values_are_default_initialized = true;
 
 	clipping_ignore_depth = 0;
@@ -288,17 +328,57 @@ ElementPtr Element::Clone() const
 	{
 		clone = instancer->InstanceElement(nullptr, GetTagName(), attributes);
 		if (clone)
+		{
+			// Process the attributes as the factory does for newly instanced elements.
 			clone->SetInstancer(instancer);
+			clone->SetAttributes(attributes);
+			ElementUtilities::BindEventAttributes(clone.get());
+
+			PluginRegistry::NotifyElementCreate(clone.get());
+		}
 	}
 	else
 		clone = Factory::InstanceElement(nullptr, GetTagName(), GetTagName(), attributes);
 
-	if (clone != nullptr)
+	if (clone == nullptr)
+		return nullptr;
+
+	// The attributes have been copied by the instancer, now copy the state which may have been changed without them.
+	if (clone->meta->style.GetClassNameList() != meta->style.GetClassNameList())
+		clone->meta->style.SetClassNames(meta->style.GetClassNames());
+
+	const PropertyMap& local_properties = meta->style.GetLocalStyleProperties();
+	std::vector<PropertyId> removed_properties;
+	for (const auto& pair : clone->meta->style.GetLocalStyleProperties())
 	{
-		String inner_rml;
-		GetInnerRML(inner_rml);
+		if (local_properties.find(pair.first) == local_properties.end())
+			removed_properties.push_back(pair.first);
+	}
+	for (PropertyId id : removed_properties)
+		clone->meta->style.RemoveProperty(id);
+	for (const auto& pair : local_properties)
+		clone->meta->style.SetProperty(pair.first, pair.second);
 
-		clone->SetInnerRML(inner_rml);
+	if (const ElementText* text = rmlui_dynamic_cast<const ElementText*>(this))
+	{
+		if (ElementText* clone_text = rmlui_dynamic_cast<ElementText*>(clone.get()))
+			clone_text->SetText(text->GetText());
+	}
+
+	clone->patch_fingerprint = patch_fingerprint;
+	clone->meta->style.SetCloneSource(this);
+
+	// Copy the children directly instead of serializing them to RML and parsing it again. Some instancers create
+	// children of their own when constructing the element, these lead our children and are matched by tag. They have
+	// been recreated along with the clone, so they are not cloned again.
+	const int num_created_children = clone->GetNumChildren();
+	for (int i = 0; i < GetNumChildren(); i++)
+	{
+		if (i < num_created_children && clone->GetChild(i)->GetTagName() == children[i]->GetTagName())
+			continue;
+
+		if (ElementPtr child_clone = children[i]->Clone())
+			clone->AppendChild(std::move(child_clone));
 	}
 
 	return clone;
@@ -307,6 +387,14 @@ ElementPtr Element::Clone() const
 // Sets or removes a class on the element.
 void Element::SetClass(const String& class_name, bool activate)
 {
+	if (dom_indexed && activate != meta->style.IsClassSet(class_name))
+	{
+		if (activate)
+			owner_document->AddToClassIndex(this, class_name);
+		else
+			owner_document->RemoveFromClassIndex(this, class_name);
+	}
+
 	meta->style.SetClass(class_name, activate);
 }
 
@@ -425,31 +513,7 @@ Vector2f Element::GetRelativeOffset(Box::Area area)
 // Returns the position of the top-left corner of one of the areas of this element's primary box.
 Vector2f Element::GetAbsoluteOffset(Box::Area area)
 {
-	if (offset_dirty)
-	{
-		offset_dirty = false;
-
-		if (offset_parent != nullptr)
-			absolute_offset = offset_parent->GetAbsoluteOffset(Box::BORDER) + relative_offset_base + relative_offset_position;
-		else
-			absolute_offset = relative_offset_base + relative_offset_position;
-
-		// Add any parent scrolling onto our position as well. Could cache this if required.
-		if (!offset_fixed)
-		{
-			Element* scroll_parent = parent;
-			while (scroll_parent != nullptr)
-			{
-				absolute_offset -= (scroll_parent->scroll_offset + scroll_parent->content_offset);
-				if (scroll_parent == offset_parent)
-					break;
-				else
-					scroll_parent = scroll_parent->parent;
-			}
-		}
-	}
-
-	return absolute_offset + GetBox().GetPosition(area);
+	return GetUnscrolledOffset(area) - GetScrollTranslation();
 }
 
 // Sets an alternate area to use as the client area.
@@ -479,7 +543,7 @@ void Element::SetContentBox(const Vector2f& _content_offset, const Vector2f& _co
 
 		scroll_offset.x = Math::Min(scroll_offset.x, GetScrollWidth() - GetClientWidth());
 		scroll_offset.y = Math::Min(scroll_offset.y, GetScrollHeight() - GetClientHeight());
-		DirtyOffset();
+		DirtyScrollTranslation();
 	}
 }
 
@@ -491,7 +555,10 @@ void Element::SetBox(const Box& box)
 		main_box = box;
 		additional_boxes.clear();
 
-		OnResize();
+		{
+			LayoutSharedLock lock;
+			OnResize();
+		}
 
 		meta->background.DirtyBackground();
 		meta->border.DirtyBorder();
@@ -504,7 +571,10 @@ void Element::AddBox(const Box& box)
 {
 	additional_boxes.push_back(box);
 
-	OnResize();
+	{
+		LayoutSharedLock lock;
+		OnResize();
+	}
 
 	meta->background.DirtyBackground();
 	meta->border.DirtyBorder();
@@ -973,7 +1043,7 @@ void Element::SetScrollLeft(float scroll_left)
 	{
 		scroll_offset.x = new_offset;
 		meta->scroll.UpdateScrollbar(ElementScroll::HORIZONTAL);
-		DirtyOffset();
+		DirtyScrollTranslation();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
@@ -993,7 +1063,7 @@ void Element::SetScrollTop(float scroll_top)
 	{
 		scroll_offset.y = new_offset;
 		meta->scroll.UpdateScrollbar(ElementScroll::VERTICAL);
-		DirtyOffset();
+		DirtyScrollTranslation();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
@@ -1121,12 +1191,26 @@ void Element::SetInnerRML(const String& rml)
 {
 	RMLUI_ZoneScopedC(0x6495ED);
 
+	BeginBatch();
+
 	// Remove all DOM children.
 	while ((int) children.size() > num_non_dom_children)
 		RemoveChild(children.front().get());
 
 	if(!rml.empty())
 		Factory::InstanceElementText(this, rml);
+
+	EndBatch();
+}
+
+// Sets the markup and content of the element, reusing the existing children where they match.
+void Element::PatchInnerRML(const String& rml)
+{
+	RMLUI_ZoneScopedC(0x6495ED);
+
+	BeginBatch();
+	ElementPatcher::PatchInnerRML(this, rml);
+	EndBatch();
 }
 
 // Sets the current element as the focus object.
@@ -1291,15 +1375,8 @@ Element* Element::AppendChild(ElementPtr child, bool dom_element)
 		num_non_dom_children++;
 	}
 
-	Element* ancestor = child_ptr;
-	for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
-		ancestor->OnChildAdd(child_ptr);
-
-	DirtyStackingContext();
-	DirtyStructure();
-
-	if (dom_element)
-		DirtyLayout();
+	ChildAdded(child_ptr);
+	DirtyChildren(dom_element);
 
 	return child_ptr;
 }
@@ -1333,19 +1410,14 @@ Element* Element::InsertBefore(ElementPtr child, Element* adjacent_element)
 		child_ptr = child.get();
 		child_ptr->SetParent(this);
 
-		if ((int) child_index >= GetNumChildren())
+		const bool dom_element = ((int) child_index < GetNumChildren());
+		if (!dom_element)
 			num_non_dom_children++;
-		else
-			DirtyLayout();
 
 		children.insert(children.begin() + child_index, std::move(child));
 
-		Element* ancestor = child_ptr;
-		for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
-			ancestor->OnChildAdd(child_ptr);
-
-		DirtyStackingContext();
-		DirtyStructure();
+		ChildAdded(child_ptr);
+		DirtyChildren(dom_element);
 	}
 	else
 	{
@@ -1378,9 +1450,7 @@ ElementPtr Element::ReplaceChild(ElementPtr inserted_element, Element* replaced_
 	children.insert(insertion_point, std::move(inserted_element));
 	ElementPtr result = RemoveChild(replaced_element);
 
-	Element* ancestor = inserted_element_ptr;
-	for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
-		ancestor->OnChildAdd(inserted_element_ptr);
+	ChildAdded(inserted_element_ptr);
 
 	return result;
 }
@@ -1395,9 +1465,19 @@ ElementPtr Element::RemoveChild(Element* child)
 		// Add the element to the delete list
 		if (itr->get() == child)
 		{
-			Element* ancestor = child;
-			for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
-				ancestor->OnChildRemove(child);
+			// A child added during the current batch hasn't been announced yet, so its removal isn't either.
+			if (child->batch_added_index >= 0)
+			{
+				RMLUI_ASSERT(batch && batch->added_children[child->batch_added_index] == child);
+				batch->added_children[child->batch_added_index] = nullptr;
+				child->batch_added_index = -1;
+			}
+			else
+			{
+				Element* ancestor = child;
+				for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
+					ancestor->OnChildRemove(child);
+			}
 
 			if (child_index >= children.size() - num_non_dom_children)
 				num_non_dom_children--;
@@ -1430,9 +1510,7 @@ ElementPtr Element::RemoveChild(Element* child)
 
 			detached_child->SetParent(nullptr);
 
-			DirtyLayout();
-			DirtyStackingContext();
-			DirtyStructure();
+			DirtyChildren(true);
 
 			return detached_child;
 		}
@@ -1449,6 +1527,46 @@ bool Element::HasChildNodes() const
 	return (int) children.size() > num_non_dom_children;
 }
 
+void Element::BeginBatch()
+{
+	if (!batch)
+		batch = std::make_unique< ElementBatch >();
+
+	batch->depth++;
+}
+
+void Element::EndBatch()
+{
+	RMLUI_ASSERT(batch && batch->depth > 0);
+	if (!batch || --batch->depth > 0)
+		return;
+
+	// The batch is kept open while notifying, so that children added or removed by the handlers are accounted for in
+	// the list being iterated.
+	batch->depth = 1;
+	for (size_t i = 0; i < batch->added_children.size(); i++)
+	{
+		if (Element* child = batch->added_children[i])
+		{
+			child->batch_added_index = -1;
+
+			Element* ancestor = child;
+			for (int level = 0; level <= ChildNotifyLevels && ancestor; level++, ancestor = ancestor->GetParentNode())
+				ancestor->OnChildAdd(child);
+		}
+	}
+
+	const bool dirty_stacking_context = batch->dirty_stacking_context;
+	const bool dirty_layout = batch->dirty_layout;
+	batch.reset();
+
+	if (dirty_stacking_context)
+		DirtyStackingContext();
+
+	if (dirty_layout)
+		DirtyLayout();
+}
+
 Element* Element::GetElementById(const String& id)
 {
 	// Check for special-case tokens.
@@ -1479,6 +1597,28 @@ void Element::GetElementsByClassName(ElementList& elements, const String& class_
 	return ElementUtilities::GetElementsByClassName(elements, this, class_name);
 }
 
+// Get the first descendant element matching the given selector.
+Element* Element::QuerySelector(const String& selector)
+{
+	return ElementUtilities::QuerySelector(this, ElementSelector(selector));
+}
+
+Element* Element::QuerySelector(const ElementSelector& selector)
+{
+	return ElementUtilities::QuerySelector(this, selector);
+}
+
+// Get all descendant elements matching the given selector.
+void Element::QuerySelectorAll(ElementList& elements, const String& selector)
+{
+	ElementUtilities::QuerySelectorAll(elements, this, ElementSelector(selector));
+}
+
+void Element::QuerySelectorAll(ElementList& elements, const ElementSelector& selector)
+{
+	ElementUtilities::QuerySelectorAll(elements, this, selector);
+}
+
 // Access the event dispatcher
 EventDispatcher* Element::GetEventDispatcher() const
 {
@@ -1596,14 +1736,32 @@ void Element::OnAttributeChange(const ElementAttributes& changed_attributes)
 	auto it = changed_attributes.find("id");
 	if (it != changed_attributes.end())
 	{
+		if (id_indexed)
+			owner_document->RemoveFromIdIndex(this);
+
 		id = it->second.Get<String>();
 		meta->style.DirtyDefinition();
+
+		if (owner_document && owner_document != this && !id.empty())
+			owner_document->AddToIdIndex(this);
 	}
 
 	it = changed_attributes.find("class");
 	if (it != changed_attributes.end())
 	{
+		if (dom_indexed)
+		{
+			for (const String& class_name : meta->style.GetClassNameList())
+				owner_document->RemoveFromClassIndex(this, class_name);
+		}
+
 		meta->style.SetClassNames(it->second.Get<String>());
+
+		if (dom_indexed)
+		{
+			for (const String& class_name : meta->style.GetClassNameList())
+				owner_document->AddToClassIndex(this, class_name);
+		}
 	}
 
 	// Add any inline style declarations.
@@ -1633,9 +1791,9 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 {
 	RMLUI_ZoneScoped;
 
-	if (!IsLayoutDirty())
+	// Force a relayout if any of the changed properties require it. This is done even if the layout is already dirty,
+	// so that the change is recorded for any cached shrink-to-fit widths.
 	{
-		// Force a relayout if any of the changed properties require it.
 		const PropertyIdSet changed_properties_forcing_layout = (changed_properties & StyleSheetSpecification::GetRegisteredPropertiesForcingLayout());
 		
 		if(!changed_properties_forcing_layout.Empty())
@@ -1803,6 +1961,19 @@ void Element::OnChildRemove(Element* /*child*/)
 void Element::DirtyLayout()
 {
 	Element* document = GetOwnerDocument();
+
+	// Invalidate the cached shrink-to-fit widths of this element and its ancestors. Any ancestor already stamped since
+	// the last width was cached has had its own ancestors stamped as well, so we can stop there. Widths are only cached
+	// within documents, so we don't stamp beyond our document; its ancestors may be shared with documents laid out in
+	// parallel.
+	const unsigned int epoch = layout_change_epoch;
+	for (Element* element = this; element != nullptr && element->layout_change_stamp != epoch; element = element->parent)
+	{
+		element->layout_change_stamp = epoch;
+		if (element == document)
+			break;
+	}
+
 	if (document != nullptr)
 		document->DirtyLayout();
 }
@@ -1926,7 +2097,20 @@ void Element::SetOwnerDocument(ElementDocument* document)
 
 		if (owner_document != document)
 		{
+			if (id_indexed)
+				owner_document->RemoveFromIdIndex(this);
+			if (dom_indexed)
+				owner_document->RemoveFromDomIndex(this);
+
 			owner_document = document;
+
+			if (owner_document && owner_document != this)
+			{
+				if (!id.empty())
+					owner_document->AddToIdIndex(this);
+				owner_document->AddToDomIndex(this);
+			}
+
 			for (ElementPtr& child : children)
 				child->SetOwnerDocument(document);
 		}
@@ -1964,6 +2148,9 @@ void Element::SetParent(Element* _parent)
 
 void Element::DirtyOffset()
 {
+	// The scroll translation depends on our offset parent, which may have changed.
+	DirtyScrollTranslation();
+
 	if(!offset_dirty)
 	{
 		offset_dirty = true;
@@ -1977,6 +2164,99 @@ void Element::DirtyOffset()
 	}
 }
 
+// Returns the position of one of the areas of this element's primary box, ignoring the scroll offset of any ancestors.
+Vector2f Element::GetUnscrolledOffset(Box::Area area)
+{
+	if (offset_dirty)
+	{
+		offset_dirty = false;
+
+		if (offset_parent != nullptr)
+			absolute_offset = offset_parent->GetUnscrolledOffset(Box::BORDER) + relative_offset_base + relative_offset_position;
+		else
+			absolute_offset = relative_offset_base + relative_offset_position;
+	}
+
+	return absolute_offset + GetBox().GetPosition(area);
+}
+
+// Returns the sum of the scroll offsets of our ancestors, which is subtracted from our unscrolled offset.
+Vector2f Element::GetScrollTranslation()
+{
+	if (scroll_translation_generation != scroll_generation)
+	{
+		scroll_translation_generation = scroll_generation;
+
+		Vector2f translation(0, 0);
+		if (offset_parent != nullptr)
+			translation = offset_parent->GetScrollTranslation();
+
+		// Add any parent scrolling between us and our offset parent.
+		if (!offset_fixed)
+		{
+			Element* scroll_parent = parent;
+			while (scroll_parent != nullptr)
+			{
+				translation += scroll_parent->scroll_offset + scroll_parent->content_offset;
+				if (scroll_parent == offset_parent)
+					break;
+				else
+					scroll_parent = scroll_parent->parent;
+			}
+		}
+
+		if (translation != scroll_translation)
+		{
+			scroll_translation = translation;
+
+			// Our transform is resolved in absolute coordinates, and must be updated to follow the new position.
+			if (transform_state)
+				DirtyTransformState(true, true);
+		}
+	}
+
+	return scroll_translation;
+}
+
+void Element::DirtyScrollTranslation()
+{
+	++scroll_generation;
+}
+
+unsigned int Element::BeginLayoutMeasurement()
+{
+	// Make sure later changes are stamped differently from our current stamp.
+	++layout_change_epoch;
+	return layout_change_stamp;
+}
+
+bool Element::GetCachedShrinkToFitWidth(float& width, const Vector2f& containing_block) const
+{
+	if (shrink_to_fit_width < 0 || shrink_to_fit_stamp != layout_change_stamp || shrink_to_fit_containing_block != containing_block)
+		return false;
+
+	width = shrink_to_fit_width;
+	return true;
+}
+
+void Element::SetCachedShrinkToFitWidth(float width, const Vector2f& containing_block, unsigned int stamp)
+{
+	shrink_to_fit_width = width;
+	shrink_to_fit_stamp = stamp;
+	shrink_to_fit_containing_block = containing_block;
+}
+
+bool Element::GetCachedVerticalOverflow(const Vector2f& overflow_box) const
+{
+	return vertical_overflow_stamp == layout_change_stamp && vertical_overflow_box == overflow_box;
+}
+
+void Element::SetCachedVerticalOverflow(const Vector2f& overflow_box, unsigned int stamp)
+{
+	vertical_overflow_box = overflow_box;
+	vertical_overflow_stamp = stamp;
+}
+
 void Element::UpdateOffset()
 {
 	using namespace Style;
@@ -2109,6 +2389,41 @@ void Element::DirtyStackingContext()
 void Element::DirtyStructure()
 {
 	structure_dirty = true;
+
+	if (owner_document)
+		owner_document->DirtyDomOrder();
+}
+
+void Element::DirtyChildren(bool dom_children)
+{
+	// The structure only sets flags, and the document's DOM order must be current for queries made during a batch.
+	DirtyStructure();
+
+	if (batch)
+	{
+		batch->dirty_stacking_context = true;
+		batch->dirty_layout |= dom_children;
+		return;
+	}
+
+	DirtyStackingContext();
+
+	if (dom_children)
+		DirtyLayout();
+}
+
+void Element::ChildAdded(Element* child)
+{
+	if (batch)
+	{
+		child->batch_added_index = (int)batch->added_children.size();
+		batch->added_children.push_back(child);
+		return;
+	}
+
+	Element* ancestor = child;
+	for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
+		ancestor->OnChildAdd(child);
 }
 
 void Element::UpdateStructure()
@@ -2435,6 +2750,9 @@ void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
 
 void Element::UpdateTransformState()
 {
+	// Make sure any change in scrolling has been applied to the transform state.
+	GetScrollTranslation();
+
 	if (!dirty_perspective && !dirty_transform)
 		return;
 
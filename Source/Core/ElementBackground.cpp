@@ -29,7 +29,6 @@
 
 #include "ElementBackground.h"
 #include "../../Include/RmlUi/Core/Element.h"
-#include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/Property.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 
@@ -78,58 +77,32 @@ void ElementBackground::GenerateBackground()
 	// Apply opacity
 	colour.alpha = (byte)(opacity * (float)colour.alpha);
 
-	if (colour.alpha <= 0)
-	{
-		geometry.GetVertices().clear();
-		geometry.GetIndices().clear();
-		geometry.Release();
+	geometry.Release(true);
 
+	if (colour.alpha <= 0)
 		return;
-	}
-
-	// Work out how many boxes we need to generate geometry for.
-	int num_boxes = 0;
 
+	std::vector< QuadInstance >& quads = geometry.GetQuads();
 	for (int i = 0; i < element->GetNumBoxes(); ++i)
-	{
-		const Box& box = element->GetBox(i);
-		Vector2f size = box.GetSize(Box::PADDING);
-		if (size.x > 0 && size.y > 0)
-			num_boxes++;
-	}
-
-	std::vector< Vertex >& vertices = geometry.GetVertices();
-	std::vector< int >& indices = geometry.GetIndices();
-
-	int index_offset = 0;
-	vertices.resize(4 * num_boxes);
-	indices.resize(6 * num_boxes);
-
-	if (num_boxes > 0)
-	{
-		Vertex* raw_vertices = &vertices[0];
-		int* raw_indices = &indices[0];
-
-		for (int i = 0; i < element->GetNumBoxes(); ++i)
-			GenerateBackground(raw_vertices, raw_indices, index_offset, element->GetBox(i), colour);
-	}
-
-	geometry.Release();
+		GenerateBackground(quads, element->GetBox(i), colour);
 }
 
 // Generates the background geometry for a single box.
-void ElementBackground::GenerateBackground(Vertex*& vertices, int*& indices, int& index_offset, const Box& box, const Colourb& colour)
+void ElementBackground::GenerateBackground(std::vector< QuadInstance >& quads, const Box& box, const Colourb& colour)
 {
 	Vector2f padded_size = box.GetSize(Box::PADDING);
 	if (padded_size.x <= 0 ||
 		padded_size.y <= 0)
 		return;
 
-	GeometryUtilities::GenerateQuad(vertices, indices, box.GetOffset(), padded_size, colour, index_offset);
+	QuadInstance quad;
+	quad.position = box.GetOffset();
+	quad.size = padded_size;
+	quad.tex_coord[0] = Vector2f(0, 0);
+	quad.tex_coord[1] = Vector2f(1, 1);
+	quad.colour = colour;
 
-	vertices += 4;
-	indices += 6;
-	index_offset += 4;
+	quads.push_back(quad);
 }
 
 }
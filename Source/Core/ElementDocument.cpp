@@ -28,6 +28,7 @@
 
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/ElementSelector.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
@@ -42,6 +43,8 @@
 #include "Template.h"
 #include "TemplateCache.h"
 #include "XMLParseTools.h"
+#include <algorithm>
+#include <tuple>
 
 namespace Rml {
 namespace Core {
@@ -56,6 +59,9 @@ ElementDocument::ElementDocument(const String& tag) : Element(tag)
 
 	position_dirty = false;
 
+	dom_order_dirty = true;
+	dom_order_generation = 0;
+
 	ForceLocalStackingContext();
 	SetOwnerDocument(this);
 
@@ -64,6 +70,17 @@ ElementDocument::ElementDocument(const String& tag) : Element(tag)
 
 ElementDocument::~ElementDocument()
 {
+	// Our descendants are detached from us after our members are destroyed, make sure they don't touch the index then.
+	for (auto& pair : id_index)
+	{
+		for (Element* element : pair.second)
+			element->id_indexed = false;
+	}
+	for (auto& pair : tag_index)
+	{
+		for (Element* element : pair.second)
+			element->dom_indexed = false;
+	}
 }
 
 void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
@@ -95,34 +112,11 @@ void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
 	title = document_header->title;
 
 	// If a style-sheet (or sheets) has been specified for this element, then we load them and set the combined sheet
-	// on the element; all of its children will inherit it by default.
-	SharedPtr<StyleSheet> new_style_sheet;
-	if (header.rcss_external.size() > 0)
-		new_style_sheet = StyleSheetFactory::GetStyleSheet(header.rcss_external);
-
-	// Combine any inline sheets.
-	if (header.rcss_inline.size() > 0)
-	{			
-		for (size_t i = 0;i < header.rcss_inline.size(); i++)
-		{			
-			UniquePtr<StyleSheet> inline_sheet = std::make_unique<StyleSheet>();
-			auto stream = std::make_unique<StreamMemory>((const byte*) header.rcss_inline[i].c_str(), header.rcss_inline[i].size());
-			stream->SetSourceURL(document_header->source);
-
-			if (inline_sheet->LoadStyleSheet(stream.get(), header.rcss_inline_line_numbers[i]))
-			{
-				if (new_style_sheet)
-				{
-					SharedPtr<StyleSheet> combined_sheet = new_style_sheet->CombineStyleSheet(*inline_sheet);
-					new_style_sheet = combined_sheet;
-				}
-				else
-					new_style_sheet = std::move(inline_sheet);
-			}
-
-			stream.reset();
-		}		
-	}
+	// on the element; all of its children will inherit it by default. Documents loaded in the background may already
+	// have had their sheets built on the loading thread.
+	SharedPtr<StyleSheet> new_style_sheet = document_header->prepared_style_sheet;
+	if (!new_style_sheet)
+		new_style_sheet = StyleSheetFactory::GetDocumentStyleSheet(header, document_header->source);
 
 	// If a style sheet is available, set it on the document and release it.
 	if (new_style_sheet)
@@ -423,6 +417,229 @@ void ElementDocument::DirtyPosition()
 	position_dirty = true;
 }
 
+void ElementDocument::AddToIdIndex(Element* element)
+{
+	RMLUI_ASSERT(!element->id_indexed && !element->GetId().empty());
+
+	id_index[element->GetId()].push_back(element);
+	element->id_indexed = true;
+}
+
+void ElementDocument::RemoveFromIdIndex(Element* element)
+{
+	RMLUI_ASSERT(element->id_indexed);
+
+	auto it = id_index.find(element->GetId());
+	if (it != id_index.end())
+	{
+		ElementList& elements = it->second;
+		auto it_element = std::find(elements.begin(), elements.end(), element);
+		if (it_element != elements.end())
+		{
+			*it_element = elements.back();
+			elements.pop_back();
+		}
+
+		if (elements.empty())
+			id_index.erase(it);
+	}
+
+	element->id_indexed = false;
+}
+
+const ElementList* ElementDocument::GetIndexedElementsById(const String& id) const
+{
+	auto it = id_index.find(id);
+	if (it == id_index.end())
+		return nullptr;
+
+	return &it->second;
+}
+
+// Removes an element from the set under the given key, and the key itself once its set is empty.
+static void RemoveFromIndex(UnorderedMap< String, UnorderedSet< Element* > >& index, const String& key, Element* element)
+{
+	auto it = index.find(key);
+	if (it != index.end())
+	{
+		it->second.erase(element);
+		if (it->second.empty())
+			index.erase(it);
+	}
+}
+
+void ElementDocument::AddToDomIndex(Element* element)
+{
+	RMLUI_ASSERT(!element->dom_indexed);
+
+	tag_index[element->GetTagName()].insert(element);
+	for (const String& class_name : element->GetStyle()->GetClassNameList())
+		class_index[class_name].insert(element);
+
+	element->dom_indexed = true;
+}
+
+void ElementDocument::RemoveFromDomIndex(Element* element)
+{
+	RMLUI_ASSERT(element->dom_indexed);
+
+	RemoveFromIndex(tag_index, element->GetTagName(), element);
+	for (const String& class_name : element->GetStyle()->GetClassNameList())
+		RemoveFromIndex(class_index, class_name, element);
+
+	element->dom_indexed = false;
+}
+
+void ElementDocument::AddToClassIndex(Element* element, const String& class_name)
+{
+	RMLUI_ASSERT(element->dom_indexed);
+	class_index[class_name].insert(element);
+}
+
+void ElementDocument::RemoveFromClassIndex(Element* element, const String& class_name)
+{
+	RMLUI_ASSERT(element->dom_indexed);
+	RemoveFromIndex(class_index, class_name, element);
+}
+
+bool ElementDocument::GetIndexedDescendantsByTag(ElementList& elements, Element* root_element, const String& tag)
+{
+	auto it = tag_index.find(tag);
+	return GetIndexedDescendants(elements, root_element, it == tag_index.end() ? nullptr : &it->second);
+}
+
+bool ElementDocument::GetIndexedDescendantsByClass(ElementList& elements, Element* root_element, const String& class_name)
+{
+	auto it = class_index.find(class_name);
+	return GetIndexedDescendants(elements, root_element, it == class_index.end() ? nullptr : &it->second);
+}
+
+bool ElementDocument::GetIndexedSelectorCandidates(ElementList& elements, Element* root_element, const ElementSelector& selector)
+{
+	const String& id = selector.GetRequiredId();
+	if (id.empty())
+	{
+		if (!selector.GetRequiredClass().empty())
+		{
+			auto it = class_index.find(selector.GetRequiredClass());
+			return GetIndexedDescendants(elements, root_element, it == class_index.end() ? nullptr : &it->second, true);
+		}
+
+		if (!selector.GetRequiredTag().empty())
+		{
+			auto it = tag_index.find(selector.GetRequiredTag());
+			return GetIndexedDescendants(elements, root_element, it == tag_index.end() ? nullptr : &it->second, true);
+		}
+
+		return false;
+	}
+
+	RMLUI_ASSERT(root_element->GetOwnerDocument() == this);
+
+	UpdateDomOrder();
+
+	if (root_element->dom_order_generation != dom_order_generation)
+		return false;
+
+	auto it = id_index.find(id);
+	if (it == id_index.end())
+		return true;
+
+	const size_t num_previous_elements = elements.size();
+
+	for (Element* element : it->second)
+	{
+		if (element->dom_order_generation == dom_order_generation &&
+			element->dom_order_begin > root_element->dom_order_begin &&
+			element->dom_order_begin <= root_element->dom_order_end)
+			elements.push_back(element);
+	}
+
+	std::sort(elements.begin() + num_previous_elements, elements.end(), [](const Element* a, const Element* b) {
+		return a->dom_order_begin < b->dom_order_begin;
+	});
+
+	return true;
+}
+
+bool ElementDocument::GetIndexedDescendants(ElementList& elements, Element* root_element, const UnorderedSet< Element* >* indexed_elements, bool document_order)
+{
+	RMLUI_ASSERT(root_element->GetOwnerDocument() == this);
+
+	UpdateDomOrder();
+
+	// Elements inside non-DOM children, such as scrollbars, are not numbered.
+	if (root_element->dom_order_generation != dom_order_generation)
+		return false;
+
+	if (indexed_elements == nullptr)
+		return true;
+
+	// The number of DOM descendants is known from the numbering, prefer visiting them if there are fewer of them.
+	if ((int)indexed_elements->size() > root_element->dom_order_end - root_element->dom_order_begin)
+		return false;
+
+	const size_t num_previous_elements = elements.size();
+
+	for (Element* element : *indexed_elements)
+	{
+		if (element->dom_order_generation == dom_order_generation &&
+			element->dom_order_begin > root_element->dom_order_begin &&
+			element->dom_order_begin <= root_element->dom_order_end)
+			elements.push_back(element);
+	}
+
+	// A breadth first search visits the elements by depth, and the elements of each depth in document order.
+	if (document_order)
+	{
+		std::sort(elements.begin() + num_previous_elements, elements.end(), [](const Element* a, const Element* b) {
+			return a->dom_order_begin < b->dom_order_begin;
+		});
+	}
+	else
+	{
+		std::sort(elements.begin() + num_previous_elements, elements.end(), [](const Element* a, const Element* b) {
+			return std::tie(a->dom_depth, a->dom_order_begin) < std::tie(b->dom_depth, b->dom_order_begin);
+		});
+	}
+
+	return true;
+}
+
+void ElementDocument::DirtyDomOrder()
+{
+	dom_order_dirty = true;
+}
+
+// Numbers the element and its DOM descendants in document order.
+void ElementDocument::AssignDomOrder(Element* element, int depth, int generation, int& counter)
+{
+	element->dom_order_generation = generation;
+	element->dom_order_begin = counter++;
+	element->dom_depth = depth;
+
+	for (int i = 0; i < element->GetNumChildren(); i++)
+		AssignDomOrder(element->GetChild(i), depth + 1, generation, counter);
+
+	element->dom_order_end = counter - 1;
+}
+
+void ElementDocument::UpdateDomOrder()
+{
+	if (dom_order_dirty)
+	{
+		// The generations are unique across documents, so that elements moved between documents are never mistaken
+		// for being numbered.
+		static int last_dom_order_generation = 0;
+		dom_order_generation = ++last_dom_order_generation;
+
+		int counter = 0;
+		AssignDomOrder(this, 0, dom_order_generation, counter);
+
+		dom_order_dirty = false;
+	}
+}
+
 void ElementDocument::DirtyLayout()
 {
 	layout_dirty = true;
@@ -176,6 +176,10 @@ void ElementImage::GenerateGeometry()
 		texcoords[1] = Vector2f(1, 1);
 	}
 
+	// Map the coordinates into the texture atlas, if the image is packed into one.
+	for (Vector2f& texcoord : texcoords)
+		texcoord = texture.MapTexCoord(GetRenderInterface(), texcoord);
+
 	const ComputedValues& computed = GetComputedValues();
 
 	float opacity = computed.opacity;
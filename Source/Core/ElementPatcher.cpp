@@ -0,0 +1,525 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementPatcher.h"
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/DataModel.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/PropertyDictionary.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/XMLParser.h"
+#include "StyleSheetParser.h"
+#include "Utilities.h"
+
+namespace Rml {
+namespace Core {
+
+// An element or a piece of text parsed from RML, without instancing it.
+struct RmlNode
+{
+	enum Type { ELEMENT, TEXT, WHITESPACE, MARKUP };
+
+	Type type = ELEMENT;
+
+	// The tag and attributes of elements.
+	String tag;
+	XMLAttributes attributes;
+
+	// The text as read from the RML, and for text nodes the text as it is displayed.
+	String data;
+	String text;
+
+	std::vector< RmlNode > children;
+};
+
+// Determines what kind of element, if any, a piece of text is instanced as; see Factory::InstanceElementText().
+static RmlNode::Type TranslateText(String& translated, const String& data)
+{
+	SystemInterface* system_interface = GetSystemInterface();
+	if (system_interface != nullptr &&
+		(system_interface->TranslateString(translated, data) > 0 ||
+		 translated.find('<') != String::npos))
+		return RmlNode::MARKUP;
+
+	for (char c : translated)
+	{
+		if (!StringUtilities::IsWhitespace(c))
+			return RmlNode::TEXT;
+	}
+
+	return RmlNode::WHITESPACE;
+}
+
+// Parses RML into a tree of nodes, handling tags and data like the XMLParser does when instancing elements.
+class RmlNodeParser : public BaseXMLParser
+{
+public:
+	RmlNodeParser(RmlNode& root)
+	{
+		RegisterCDATATag("script");
+		stack.push_back(&root);
+	}
+
+	void HandleElementStart(const String& name, const XMLAttributes& attributes) override
+	{
+		RmlNode* parent = stack.back();
+		parent->children.emplace_back();
+
+		RmlNode* node = &parent->children.back();
+		node->tag = StringUtilities::ToLower(name);
+		node->attributes = attributes;
+
+		stack.push_back(node);
+	}
+
+	void HandleElementEnd(const String& /*name*/) override
+	{
+		if (stack.size() > 1)
+			stack.pop_back();
+	}
+
+	void HandleData(const String& data) override
+	{
+		RmlNode* parent = stack.back();
+		parent->children.emplace_back();
+
+		RmlNode& node = parent->children.back();
+		node.tag = "#text";
+		node.data = data;
+		node.type = TranslateText(node.text, data);
+	}
+
+private:
+	// The nodes currently open, the children of a node are only added while it's at the top.
+	std::vector< RmlNode* > stack;
+};
+
+// Returns true if elements with the given tag are created and parsed like generic elements. Other elements, such as
+// form controls, may restructure their children or only read their attributes when instanced, and are replaced rather
+// than patched.
+static bool IsGenericElement(const String& tag)
+{
+	return Factory::GetElementInstancer(tag) == Factory::GetElementInstancer("*") && XMLParser::GetNodeHandler(tag) == nullptr;
+}
+
+// Event attributes are bound when an element is instanced, see ElementUtilities::BindEventAttributes().
+static bool IsEventAttribute(const String& name)
+{
+	return name.size() > 2 && name[0] == 'o' && name[1] == 'n';
+}
+
+// Returns the key which an element must share with a node to be matched to it regardless of position, or an empty string
+// if it is matched by its tag and position.
+static String GetMatchKey(const String& tag, const String& id, const String& key)
+{
+	if (id.empty() && key.empty())
+		return String();
+
+	return tag + '#' + id + '#' + key;
+}
+
+static String GetMatchKey(const Element* element)
+{
+	return GetMatchKey(element->GetTagName(), element->GetId(), element->GetAttribute< String >("key", String()));
+}
+
+static String GetMatchKey(const RmlNode& node)
+{
+	return GetMatchKey(node.tag, Get< String >(node.attributes, "id", String()), Get< String >(node.attributes, "key", String()));
+}
+
+static bool EqualAttributes(const ElementAttributes& a, const XMLAttributes& b)
+{
+	if (a.size() != b.size())
+		return false;
+
+	for (auto& pair : a)
+	{
+		auto it = b.find(pair.first);
+		if (it == b.end() || it->second != pair.second)
+			return false;
+	}
+
+	return true;
+}
+
+// Returns a hash of the tags, attributes and text of a node and its descendants.
+static size_t GetFingerprint(const RmlNode& node)
+{
+	size_t seed = std::hash< String >()(node.tag);
+
+	// The attributes may be stored in any order, so their hashes are combined by addition.
+	size_t attributes_hash = 0;
+	for (auto& pair : node.attributes)
+	{
+		size_t attribute_hash = std::hash< String >()(pair.first);
+		Utilities::HashCombine(attribute_hash, pair.second.Get< String >());
+		attributes_hash += attribute_hash;
+	}
+	Utilities::HashCombine(seed, attributes_hash);
+	Utilities::HashCombine(seed, node.data);
+
+	for (const RmlNode& child : node.children)
+		Utilities::HashCombine(seed, GetFingerprint(child));
+
+	return seed;
+}
+
+// Writes a node back to RML, for instancing it through the XML parser.
+static void SerializeNode(String& rml, const RmlNode& node, bool cdata_parent = false)
+{
+	if (node.type != RmlNode::ELEMENT)
+	{
+		if (!cdata_parent && node.data.find('<') != String::npos)
+			rml += "<![CDATA[" + node.data + "]]>";
+		else
+			rml += node.data;
+		return;
+	}
+
+	rml += '<' + node.tag;
+	for (auto& pair : node.attributes)
+	{
+		const String value = pair.second.Get< String >();
+		const char quote = (value.find('"') == String::npos ? '"' : '\'');
+		rml += ' ' + pair.first + '=' + quote + value + quote;
+	}
+	rml += '>';
+
+	for (const RmlNode& child : node.children)
+		SerializeNode(rml, child, node.tag == "script");
+
+	rml += "</" + node.tag + '>';
+}
+
+void ElementPatcher::PatchInnerRML(Element* element, const String& rml)
+{
+	RmlNode root;
+
+	// Follow Factory::InstanceElementText(), which only parses the RML as markup when it contains any.
+	String translated;
+	root.type = TranslateText(translated, rml);
+
+	if (root.type == RmlNode::MARKUP)
+	{
+		StreamMemory stream(translated.size() + 32);
+		stream.Write("<body>", 6);
+		stream.Write(translated);
+		stream.Write("</body>", 7);
+		stream.Seek(0, SEEK_SET);
+
+		RmlNode body;
+		RmlNodeParser parser(body);
+		parser.Parse(&stream);
+
+		if (!body.children.empty())
+			root.children = std::move(body.children.front().children);
+	}
+	else if (root.type == RmlNode::TEXT)
+	{
+		root.children.emplace_back();
+		root.children.back().tag = "#text";
+		root.children.back().type = RmlNode::TEXT;
+		root.children.back().data = rml;
+		root.children.back().text = translated;
+	}
+
+	PatchChildren(element, root.children);
+}
+
+void ElementPatcher::PatchChildren(Element* element, const std::vector< RmlNode >& nodes)
+{
+	const int num_children = element->GetNumChildren();
+
+	ElementList children(num_children);
+	StringList keys(num_children);
+	std::vector< bool > matched(num_children, false);
+	UnorderedMap< String, int > keyed_children;
+
+	for (int i = 0; i < num_children; i++)
+	{
+		children[i] = element->GetChild(i);
+		keys[i] = GetMatchKey(children[i]);
+		if (!keys[i].empty())
+			keyed_children.emplace(keys[i], i);
+	}
+
+	// Find the elements to place at each position, either an existing child or newly instanced ones. Nodes without a
+	// key are matched in order to the next unmatched child with the same tag.
+	struct Target {
+		Element* element;
+		std::vector< ElementPtr > new_elements;
+	};
+	std::vector< Target > targets;
+	targets.reserve(nodes.size());
+
+	int next_unkeyed_child = 0;
+
+	for (const RmlNode& node : nodes)
+	{
+		if (node.type == RmlNode::WHITESPACE)
+			continue;
+
+		int match = -1;
+		if (node.type != RmlNode::MARKUP)
+		{
+			const String key = GetMatchKey(node);
+			if (!key.empty())
+			{
+				auto it = keyed_children.find(key);
+				if (it != keyed_children.end() && !matched[it->second])
+					match = it->second;
+			}
+			else
+			{
+				for (int i = next_unkeyed_child; i < num_children; i++)
+				{
+					if (!matched[i] && keys[i].empty() && children[i]->GetTagName() == node.tag)
+					{
+						match = i;
+						next_unkeyed_child = i + 1;
+						break;
+					}
+				}
+			}
+		}
+
+		targets.emplace_back();
+		Target& target = targets.back();
+
+		if (match >= 0 && PatchElement(children[match], node))
+		{
+			matched[match] = true;
+			target.element = children[match];
+		}
+		else
+		{
+			target.element = nullptr;
+			InstanceNode(target.new_elements, element, node);
+		}
+	}
+
+	for (int i = 0; i < num_children; i++)
+	{
+		if (!matched[i])
+			element->RemoveChild(children[i]);
+	}
+
+	// Move the new children in, and any reordered existing children into place.
+	int position = 0;
+	for (Target& target : targets)
+	{
+		if (target.element)
+		{
+			Element* current = (position < element->GetNumChildren() ? element->GetChild(position) : nullptr);
+			if (target.element != current)
+			{
+				ElementPtr moved_element = element->RemoveChild(target.element);
+				if (current)
+					element->InsertBefore(std::move(moved_element), current);
+				else
+					element->AppendChild(std::move(moved_element));
+			}
+
+			position++;
+		}
+
+		for (ElementPtr& new_element : target.new_elements)
+		{
+			Element* current = (position < element->GetNumChildren() ? element->GetChild(position) : nullptr);
+			Element* inserted_element = nullptr;
+			if (current)
+				inserted_element = element->InsertBefore(std::move(new_element), current);
+			else
+				inserted_element = element->AppendChild(std::move(new_element));
+
+			// The new elements were instanced outside of the document, so bind them to any data model once inserted.
+			DataModel::BindElementTree(inserted_element);
+
+			position++;
+		}
+	}
+}
+
+bool ElementPatcher::PatchElement(Element* element, const RmlNode& node)
+{
+	if (node.type == RmlNode::TEXT)
+	{
+		ElementText* text_element = rmlui_dynamic_cast< ElementText* >(element);
+		if (!text_element || element->GetNumAttributes() > 0)
+			return false;
+
+		// The text of data bindings has been replaced by their values, so instance the binding again.
+		if (node.text.find("{{") != String::npos)
+			return false;
+
+		if (text_element->GetText() != node.text)
+			text_element->SetText(node.text);
+
+		return true;
+	}
+
+	if (!IsGenericElement(node.tag))
+	{
+		// These elements may have moved or created children of their own since they were instanced, so compare the
+		// node to the one they were created from.
+		const size_t fingerprint = GetFingerprint(node);
+		if (element->patch_fingerprint == 0 && EqualTrees(element, node))
+			element->patch_fingerprint = fingerprint;
+
+		return element->patch_fingerprint == fingerprint;
+	}
+
+	const ElementAttributes& attributes = element->GetAttributes();
+
+	ElementAttributes changed_attributes;
+	StringList removed_attributes;
+
+	for (auto& pair : node.attributes)
+	{
+		auto it = attributes.find(pair.first);
+		if (it == attributes.end() || it->second != pair.second)
+		{
+			if (IsEventAttribute(pair.first))
+				return false;
+			changed_attributes.emplace(pair.first, pair.second);
+		}
+	}
+
+	for (auto& pair : attributes)
+	{
+		if (node.attributes.find(pair.first) == node.attributes.end())
+		{
+			if (IsEventAttribute(pair.first))
+				return false;
+			removed_attributes.push_back(pair.first);
+		}
+	}
+
+	// Setting a new style attribute only adds its properties, so remove those only declared by the old one.
+	auto it_style = attributes.find("style");
+	if (it_style != attributes.end() && (changed_attributes.count("style") > 0 || node.attributes.count("style") == 0))
+	{
+		StyleSheetParser parser;
+		PropertyDictionary old_properties, new_properties;
+		parser.ParseProperties(old_properties, it_style->second.Get< String >());
+
+		auto it_node_style = node.attributes.find("style");
+		if (it_node_style != node.attributes.end())
+			parser.ParseProperties(new_properties, it_node_style->second.Get< String >());
+
+		for (auto& pair : old_properties.GetProperties())
+		{
+			if (!new_properties.GetProperty(pair.first))
+				element->RemoveProperty(pair.first);
+		}
+	}
+
+	for (const String& name : removed_attributes)
+		element->RemoveAttribute(name);
+
+	if (!changed_attributes.empty())
+		element->SetAttributes(changed_attributes);
+
+	PatchChildren(element, node.children);
+
+	return true;
+}
+
+bool ElementPatcher::EqualTrees(const Element* element, const RmlNode& node)
+{
+	if (node.type == RmlNode::TEXT)
+	{
+		const ElementText* text_element = rmlui_dynamic_cast< const ElementText* >(element);
+		return text_element && text_element->GetText() == node.text;
+	}
+
+	if (node.type != RmlNode::ELEMENT || element->GetTagName() != node.tag || !EqualAttributes(element->GetAttributes(), node.attributes))
+		return false;
+
+	int child_index = 0;
+	for (const RmlNode& child : node.children)
+	{
+		if (child.type == RmlNode::WHITESPACE)
+			continue;
+
+		if (child_index >= element->GetNumChildren() || !EqualTrees(element->GetChild(child_index), child))
+			return false;
+
+		child_index++;
+	}
+
+	return child_index == element->GetNumChildren();
+}
+
+void ElementPatcher::InstanceNode(std::vector< ElementPtr >& elements, Element* parent, const RmlNode& node)
+{
+	if (node.type == RmlNode::TEXT)
+	{
+		ElementPtr element = Factory::InstanceElement(parent, "#text", "#text", XMLAttributes());
+		if (ElementText* text_element = rmlui_dynamic_cast< ElementText* >(element.get()))
+		{
+			text_element->SetText(node.text);
+			elements.push_back(std::move(element));
+		}
+		return;
+	}
+
+	// Instance the node into a detached element, which is never styled or laid out, then take its children.
+	ElementPtr source = Factory::InstanceElement(nullptr, "*", parent->GetTagName(), XMLAttributes());
+	if (!source)
+		return;
+
+	if (node.type == RmlNode::MARKUP)
+	{
+		Factory::InstanceElementText(source.get(), node.data);
+	}
+	else
+	{
+		String rml = "<body>";
+		SerializeNode(rml, node);
+		rml += "</body>";
+
+		StreamMemory stream((const byte*)rml.c_str(), rml.size());
+		Factory::InstanceElementStream(source.get(), &stream);
+	}
+
+	while (source->HasChildNodes())
+		elements.push_back(source->RemoveChild(source->GetFirstChild()));
+
+	if (node.type == RmlNode::ELEMENT && elements.size() == 1 && !IsGenericElement(node.tag))
+		elements.back()->patch_fingerprint = GetFingerprint(node);
+}
+
+}
+}
@@ -0,0 +1,68 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREELEMENTPATCHER_H
+#define RMLUICOREELEMENTPATCHER_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+namespace Core {
+
+class Element;
+struct RmlNode;
+
+/**
+	Patches the content of an element to match new RML. The RML is parsed into a lightweight node tree which is matched
+	against the existing children by tag, id and 'key' attribute. Only the differences in attributes, text and structure
+	are applied, so unchanged elements keep their style and layout, and elements are only instanced for new content.
+ */
+
+class ElementPatcher
+{
+public:
+	/// Patches the DOM children of an element to match the given RML.
+	/// @param[in] element The element to patch.
+	/// @param[in] rml The new content of the element.
+	static void PatchInnerRML(Element* element, const String& rml);
+
+private:
+	// Patches the DOM children of an element to match the given nodes.
+	static void PatchChildren(Element* element, const std::vector< RmlNode >& nodes);
+	// Patches an existing element to match a node, returns false if it must be replaced instead.
+	static bool PatchElement(Element* element, const RmlNode& node);
+	// Returns true if an element and its DOM descendants were created from the given node.
+	static bool EqualTrees(const Element* element, const RmlNode& node);
+	// Instances the elements described by a node.
+	static void InstanceNode(std::vector< ElementPtr >& elements, Element* parent, const RmlNode& node);
+};
+
+}
+}
+
+#endif
@@ -28,6 +28,7 @@
 
 #include "../../Include/RmlUi/Core/ElementScroll.h"
 #include "LayoutEngine.h"
+#include "LayoutScheduler.h"
 #include "WidgetSliderScroll.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
@@ -78,6 +79,8 @@ void ElementScroll::Update()
 // Enables and sizes one of the scrollbars.
 void ElementScroll::EnableScrollbar(Orientation orientation, float element_width)
 {
+	LayoutSharedLock lock;
+
 	if (!scrollbars[orientation].enabled)
 	{
 		CreateScrollbar(orientation);
@@ -160,6 +163,8 @@ float ElementScroll::GetScrollbarSize(Orientation orientation)
 // Formats the enabled scrollbars based on the current size of the host element.
 void ElementScroll::FormatScrollbars()
 {
+	LayoutSharedLock lock;
+
 	Vector2f containing_block = element->GetBox().GetSize(Box::PADDING);
 
 	for (int i = 0; i < 2; i++)
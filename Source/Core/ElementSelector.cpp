@@ -0,0 +1,157 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../Include/RmlUi/Core/ElementSelector.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "StyleSheetNode.h"
+#include "StyleSheetParser.h"
+#include <algorithm>
+
+namespace Rml {
+namespace Core {
+
+ElementSelector::ElementSelector()
+{}
+
+ElementSelector::ElementSelector(const String& selector)
+{
+	Compile(selector);
+}
+
+ElementSelector::ElementSelector(const ElementSelector& other)
+{
+	Compile(other.source);
+}
+
+ElementSelector::ElementSelector(ElementSelector&& other) noexcept = default;
+
+ElementSelector& ElementSelector::operator=(const ElementSelector& other)
+{
+	if (this != &other)
+		Compile(other.source);
+	return *this;
+}
+
+ElementSelector& ElementSelector::operator=(ElementSelector&& other) noexcept = default;
+
+ElementSelector::~ElementSelector()
+{}
+
+bool ElementSelector::Compile(const String& selector)
+{
+	source = selector;
+	root = std::make_unique<StyleSheetNode>();
+	leaf_nodes.clear();
+	required_id.clear();
+	required_class.clear();
+	required_tag.clear();
+
+	StringList selector_list;
+	StringUtilities::ExpandString(selector_list, selector);
+
+	for (String& rule_name : selector_list)
+	{
+		if (rule_name.empty())
+			continue;
+
+		const StyleSheetNode* leaf_node = StyleSheetParser::CreateSelectorNodes(root.get(), std::move(rule_name));
+
+		// Equal selectors end in the same leaf node.
+		if (leaf_node != root.get() && std::find(leaf_nodes.begin(), leaf_nodes.end(), leaf_node) == leaf_nodes.end())
+			leaf_nodes.push_back(leaf_node);
+	}
+
+	// An id, class or tag can only be used to look up candidates when every selector requires it.
+	if (!leaf_nodes.empty())
+	{
+		required_id = leaf_nodes[0]->GetId();
+		required_tag = leaf_nodes[0]->GetTag();
+		for (const StyleSheetNode* leaf_node : leaf_nodes)
+		{
+			if (leaf_node->GetId() != required_id)
+				required_id.clear();
+			if (leaf_node->GetTag() != required_tag)
+				required_tag.clear();
+		}
+
+		for (const String& class_name : leaf_nodes[0]->GetClassNames())
+		{
+			const bool required_by_all = std::all_of(leaf_nodes.begin(), leaf_nodes.end(), [&class_name](const StyleSheetNode* leaf_node) {
+				const StringList& class_names = leaf_node->GetClassNames();
+				return std::find(class_names.begin(), class_names.end(), class_name) != class_names.end();
+			});
+
+			if (required_by_all)
+			{
+				required_class = class_name;
+				break;
+			}
+		}
+	}
+
+	return !leaf_nodes.empty();
+}
+
+bool ElementSelector::IsValid() const
+{
+	return !leaf_nodes.empty();
+}
+
+const String& ElementSelector::GetSource() const
+{
+	return source;
+}
+
+bool ElementSelector::Matches(const Element* element) const
+{
+	for (const StyleSheetNode* leaf_node : leaf_nodes)
+	{
+		if (leaf_node->IsApplicable(element, false))
+			return true;
+	}
+
+	return false;
+}
+
+const String& ElementSelector::GetRequiredId() const
+{
+	return required_id;
+}
+
+const String& ElementSelector::GetRequiredClass() const
+{
+	return required_class;
+}
+
+const String& ElementSelector::GetRequiredTag() const
+{
+	return required_tag;
+}
+
+}
+}
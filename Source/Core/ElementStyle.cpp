@@ -177,8 +177,14 @@ void ElementStyle::UpdateDefinition()
 		
 		if (auto& style_sheet = element->GetStyleSheet())
 		{
-			new_definition = style_sheet->GetElementDefinition(element);
+			// Cloned elements reuse the definition of their source when matched alike, skipping the selector matching.
+			if (clone_source && CanReuseCloneSourceDefinition(*style_sheet))
+				new_definition = clone_source->definition;
+			else
+				new_definition = style_sheet->GetElementDefinition(element);
 		}
+
+		clone_source.reset();
 		
 		// Switch the property definitions if the definition has changed.
 		if (new_definition != definition)
@@ -221,6 +227,60 @@ void ElementStyle::UpdateDefinition()
 
 
 
+void ElementStyle::SetCloneSource(const Element* source)
+{
+	const ElementStyle* source_style = source->GetStyle();
+	if (!source_style->definition || source_style->definition_dirty)
+	{
+		clone_source.reset();
+		return;
+	}
+
+	clone_source = std::make_unique<CloneSource>();
+	clone_source->element = source->GetObserverPtr();
+	clone_source->definition = source_style->definition;
+}
+
+bool ElementStyle::CanReuseCloneSourceDefinition(const StyleSheet& style_sheet) const
+{
+	// Definitions depending on the position among siblings can't be compared by the hierarchy alone.
+	const Element* source = clone_source->element.get();
+	if (!source || source->GetStyleSheet().get() != &style_sheet || style_sheet.HasStructuralSelectors())
+		return false;
+
+	// The source definition must still be current, which holds as long as neither the source nor its ancestors
+	// have been restyled since.
+	const ElementStyle* source_style = source->GetStyle();
+	if (source_style->definition != clone_source->definition)
+		return false;
+
+	for (const Element* ancestor = source; ancestor; ancestor = ancestor->GetParentNode())
+	{
+		if (ancestor->GetStyle()->definition_dirty)
+			return false;
+	}
+
+	// Walk up both hierarchies until they meet, each pair of elements must agree on everything a selector can test.
+	const Element* a = element;
+	const Element* b = source;
+	while (a != b)
+	{
+		if (!a || !b)
+			return false;
+
+		const ElementStyle* style_a = a->GetStyle();
+		const ElementStyle* style_b = b->GetStyle();
+		if (a->GetTagName() != b->GetTagName() || a->GetId() != b->GetId() ||
+			style_a->classes != style_b->classes || style_a->pseudo_classes != style_b->pseudo_classes)
+			return false;
+
+		a = a->GetParentNode();
+		b = b->GetParentNode();
+	}
+
+	return true;
+}
+
 // Sets or removes a pseudo-class on the element.
 void ElementStyle::SetPseudoClass(const String& pseudo_class, bool activate)
 {
@@ -285,6 +345,11 @@ void ElementStyle::SetClassNames(const String& class_names)
 	DirtyDefinition();
 }
 
+const StringList& ElementStyle::GetClassNameList() const
+{
+	return classes;
+}
+
 // Returns the list of classes specified for this element.
 String ElementStyle::GetClassNames() const
 {
@@ -30,6 +30,7 @@
 #define RMLUICOREELEMENTSTYLE_H
 
 #include "../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../Include/RmlUi/Core/ObserverPtr.h"
 #include "../../Include/RmlUi/Core/Types.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
@@ -39,6 +40,7 @@ namespace Core {
 
 class ElementDefinition;
 class PropertiesIterator;
+class StyleSheet;
 enum class RelativeTarget;
 
 /**
@@ -59,6 +61,11 @@ public:
 	/// Update this definition if required
 	void UpdateDefinition();
 
+	/// Sets the element this element was cloned from. The next time the definition is updated, the definition of the
+	/// source is reused instead of being looked up in the style sheet if both elements are still matched alike.
+	/// @param[in] source The element this element was cloned from.
+	void SetCloneSource(const Element* source);
+
 	/// Sets or removes a pseudo-class on the element.
 	/// @param[in] pseudo_class The pseudo class to activate or deactivate.
 	/// @param[in] activate True if the pseudo-class is to be activated, false to be deactivated.
@@ -84,6 +91,8 @@ public:
 	/// Return the active class list.
 	/// @return A string containing all the classes on the element, separated by spaces.
 	String GetClassNames() const;
+	/// Returns the individual classes set on the element.
+	const StringList& GetClassNameList() const;
 
 	/// Sets a local property override on the element to a pre-parsed value.
 	/// @param[in] name The name of the new property.
@@ -145,6 +154,9 @@ private:
 	// Sets a list of properties as dirty.
 	void DirtyProperties(const PropertyIdSet& properties);
 
+	// Returns true if the definition of the clone source applies to this element in its current hierarchy.
+	bool CanReuseCloneSourceDefinition(const StyleSheet& style_sheet) const;
+
 	static const Property* GetLocalProperty(PropertyId id, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
 	static const Property* GetProperty(PropertyId id, const Element * element, const PropertyDictionary & inline_properties, const ElementDefinition * definition);
 	static void TransitionPropertyChanges(Element * element, PropertyIdSet & properties, const PropertyDictionary & inline_properties, const ElementDefinition * old_definition, const ElementDefinition * new_definition);
@@ -164,6 +176,13 @@ private:
 	// Set if a new element definition should be fetched from the style.
 	bool definition_dirty;
 
+	struct CloneSource {
+		ObserverPtr<Element> element;
+		SharedPtr<ElementDefinition> definition;
+	};
+	// The element this element was cloned from and its definition at the time, until the definition is first updated.
+	UniquePtr<CloneSource> clone_source;
+
 	PropertyIdSet dirty_properties;
 };
 
@@ -38,6 +38,7 @@
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/Property.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include <algorithm>
 
 namespace Rml {
 namespace Core {
@@ -68,6 +69,8 @@ void ElementTextDefault::SetText(const String& _text)
 	if (text != _text)
 	{
 		text = _text;
+		token_caches[0].valid = false;
+		token_caches[1].valid = false;
 
 		if (dirty_layout_on_change)
 			DirtyLayout();
@@ -171,6 +174,16 @@ bool ElementTextDefault::GenerateToken(float& token_width, int line_begin)
 							white_space_property == WhiteSpace::Prewrap ||
 							white_space_property == WhiteSpace::Preline;
 
+	// Use the cached token if one begins here.
+	TokenCache& cache = UpdateTokenCache(font_face_handle, collapse_white_space, break_at_endline, computed.text_transform, true);
+	const int token_index = FindToken(cache, line_begin);
+	if (token_index >= 0)
+	{
+		Token& token = cache.tokens[token_index];
+		token_width = (float)GetFirstTokenWidth(font_face_handle, cache, token, true);
+		return token.last;
+	}
+
 	const char* token_begin = text.c_str() + line_begin;
 	String token;
 
@@ -214,6 +227,64 @@ bool ElementTextDefault::GenerateLine(String& line, int& line_length, float& lin
 	// Determine what (if any) text transformation we are putting the characters through.
 	TextTransform text_transform_property = computed.text_transform;
 
+	// Lines are normally broken at the boundaries of the cached tokens, in which case we only need to add up their
+	// widths. The text is only measured again where a token's width depends on its position on the line.
+	TokenCache& cache = UpdateTokenCache(font_face_handle, collapse_white_space, break_at_endline, text_transform_property, decode_escape_characters);
+	const int first_token_index = FindToken(cache, line_begin);
+	if (first_token_index >= 0)
+	{
+		const String& token_text = cache.text;
+
+		for (int i = first_token_index; i < (int)cache.tokens.size(); i++)
+		{
+			Token& token = cache.tokens[i];
+
+			int text_begin = token.text_begin;
+			int text_length = token.text_length;
+			int token_width = 0;
+
+			if (line.empty())
+			{
+				if (trim_whitespace_prefix && token.trimmable)
+				{
+					text_begin++;
+					text_length--;
+				}
+				token_width = GetFirstTokenWidth(font_face_handle, cache, token, trim_whitespace_prefix);
+			}
+			else if (i == first_token_index || cache.tokens[i - 1].text_length == 0)
+			{
+				// The cached width assumes the token follows the last character of the previous token.
+				Character previous_codepoint = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&line.back(), line.data()));
+				token_width = GetFontEngineInterface()->GetStringWidth(font_face_handle, token_text.substr(text_begin, text_length), previous_codepoint);
+			}
+			else
+			{
+				token_width = token.width;
+			}
+
+			// If we're breaking to fit a line box, check if the token can fit on the line before we add it.
+			if (break_at_line)
+			{
+				if (!line.empty() &&
+					(line_width + token_width > maximum_line_width ||
+					 (token.last && line_width + token_width > maximum_line_width - right_spacing_width)))
+				{
+					return false;
+				}
+			}
+
+			line.append(token_text, text_begin, text_length);
+			line_length += token.end - token.begin;
+			line_width += token_width;
+
+			if (token.break_line)
+				return false;
+		}
+
+		return true;
+	}
+
 	// Starting at the line_begin character, we generate sections of the text (we'll call them tokens) depending on the
 	// white-space parsing parameters. Each section is then appended to the line if it can fit. If not, or if an
 	// endline is found (and we're processing them), then the line is ended. kthxbai!
@@ -259,6 +330,92 @@ bool ElementTextDefault::GenerateLine(String& line, int& line_length, float& lin
 	return true;
 }
 
+// Regenerates the token cache if the text, font face or text processing options have changed since it was generated.
+ElementTextDefault::TokenCache& ElementTextDefault::UpdateTokenCache(FontFaceHandle font_face_handle, bool collapse_white_space, bool break_at_endline, Style::TextTransform text_transform, bool decode_escape_characters)
+{
+	TokenCache& cache = token_caches[decode_escape_characters ? 1 : 0];
+	if (cache.valid &&
+		cache.font_face_handle == font_face_handle &&
+		cache.collapse_white_space == collapse_white_space &&
+		cache.break_at_endline == break_at_endline &&
+		cache.text_transform == text_transform)
+		return cache;
+
+	RMLUI_ZoneScoped;
+
+	FontEngineInterface* font_engine_interface = GetFontEngineInterface();
+
+	cache.font_face_handle = font_face_handle;
+	cache.collapse_white_space = collapse_white_space;
+	cache.break_at_endline = break_at_endline;
+	cache.text_transform = text_transform;
+	cache.valid = true;
+
+	cache.text.clear();
+	cache.tokens.clear();
+
+	// Tokenise the text just as when generating lines, starting from the beginning. Each token is measured as if it
+	// follows the previous token on the same line.
+	String token;
+	const char* token_begin = text.c_str();
+	const char* string_end = text.c_str() + text.size();
+	while (token_begin != string_end)
+	{
+		Token cached_token;
+		cached_token.begin = (int)(token_begin - text.c_str());
+		cached_token.trimmable = false;
+
+		Character previous_codepoint = Character::Null;
+		if (!cache.tokens.empty() && cache.tokens.back().text_length > 0)
+			previous_codepoint = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&cache.text.back(), cache.text.data()));
+
+		token.clear();
+		cached_token.break_line = BuildToken(token, token_begin, string_end, false, collapse_white_space, break_at_endline, text_transform, decode_escape_characters);
+		cached_token.end = (int)(token_begin - text.c_str());
+		cached_token.last = LastToken(token_begin, string_end, collapse_white_space, break_at_endline);
+
+		// When collapsing white-space, a token which starts with white-space and contains a word gets a single leading
+		// space, which is left out at the beginning of a line if its white-space prefix is trimmed.
+		cached_token.trimmable = (collapse_white_space && StringUtilities::IsWhitespace(text[cached_token.begin]) && !token.empty() && token[0] == ' ');
+
+		cached_token.text_begin = (int)cache.text.size();
+		cached_token.text_length = (int)token.size();
+		cached_token.width = font_engine_interface->GetStringWidth(font_face_handle, token, previous_codepoint);
+		cached_token.first_width[0] = -1;
+		cached_token.first_width[1] = -1;
+
+		cache.text += token;
+		cache.tokens.push_back(cached_token);
+	}
+
+	return cache;
+}
+
+// Returns the index of the cached token beginning at the given character, or -1 if there is no such token.
+int ElementTextDefault::FindToken(const TokenCache& cache, int token_begin)
+{
+	auto it = std::lower_bound(cache.tokens.begin(), cache.tokens.end(), token_begin, [](const Token& token, int begin) { return token.begin < begin; });
+	if (it == cache.tokens.end() || it->begin != token_begin)
+		return -1;
+
+	return (int)(it - cache.tokens.begin());
+}
+
+// Returns the width of a cached token placed at the beginning of a line.
+int ElementTextDefault::GetFirstTokenWidth(FontFaceHandle font_face_handle, const TokenCache& cache, Token& token, bool trim_whitespace_prefix)
+{
+	const bool trim = (trim_whitespace_prefix && token.trimmable);
+	int& width = token.first_width[trim ? 1 : 0];
+	if (width < 0)
+	{
+		const int text_begin = token.text_begin + (trim ? 1 : 0);
+		const int text_length = token.text_length - (trim ? 1 : 0);
+		width = GetFontEngineInterface()->GetStringWidth(font_face_handle, cache.text.substr(text_begin, text_length));
+	}
+
+	return width;
+}
+
 // Clears all lines of generated text and prepares the element for generating new lines.
 void ElementTextDefault::ClearLines()
 {
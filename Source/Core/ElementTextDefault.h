@@ -107,8 +107,53 @@ private:
 	// Generates any geometry necessary for rendering a line decoration (underline, strike-through, etc).
 	void GenerateLineDecoration(const FontFaceHandle font_face_handle, const Line& line);
 
+	// A token of the text as generated when breaking lines, along with its measured width.
+	struct Token
+	{
+		// The range of characters in the source text making up the token.
+		int begin, end;
+		// The range of the processed token in the token cache's text.
+		int text_begin, text_length;
+		// True if the token starts with a collapsed space, which is removed when the token begins a line with its white-space prefix trimmed.
+		bool trimmable;
+		// True if the token ends with a forced line break.
+		bool break_line;
+		// True if there are no more tokens after this one.
+		bool last;
+		// The width of the token when following the previous token on a line.
+		int width;
+		// The width of the token when beginning a line, with and without its white-space prefix trimmed; -1 until measured.
+		int first_width[2];
+	};
+
+	// The tokenised text, valid for the font face and text processing options it was generated with. The token widths
+	// do not depend on the font version, which only changes when the font's layers are regenerated.
+	struct TokenCache
+	{
+		FontFaceHandle font_face_handle = 0;
+		bool collapse_white_space = false;
+		bool break_at_endline = false;
+		Style::TextTransform text_transform = Style::TextTransform::None;
+		bool valid = false;
+
+		String text;
+		std::vector< Token > tokens;
+	};
+
+	// Returns the token cache for the given escape character decoding, regenerating it if the text, font face or text
+	// processing options have changed since it was generated.
+	TokenCache& UpdateTokenCache(FontFaceHandle font_face_handle, bool collapse_white_space, bool break_at_endline, Style::TextTransform text_transform, bool decode_escape_characters);
+	// Returns the index of the cached token beginning at the given character, or -1 if there is no such token.
+	static int FindToken(const TokenCache& cache, int token_begin);
+	// Returns the width of a cached token placed at the beginning of a line.
+	static int GetFirstTokenWidth(FontFaceHandle font_face_handle, const TokenCache& cache, Token& token, bool trim_whitespace_prefix);
+
 	String text;
 
+	// The text is tokenised separately with and without decoding escape characters, as layout decodes them while text
+	// input widgets do not.
+	TokenCache token_caches[2];
+
 	typedef std::vector< Line > LineList;
 	LineList lines;
 
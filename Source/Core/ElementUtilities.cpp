@@ -29,7 +29,9 @@
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/TransformState.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementScroll.h"
+#include "../../Include/RmlUi/Core/ElementSelector.h"
 #include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
@@ -73,8 +75,69 @@ static void SetElementOffset(Element* element, const Vector2f& offset)
 	element->SetOffset(relative_offset, element->GetParentNode());
 }
 
+// Returns the number of generations between an element and one of its ancestors, only following DOM children. Returns -1
+// if the element is not a DOM descendant of the ancestor.
+static int GetDomDepth(Element* element, Element* ancestor)
+{
+	int depth = 0;
+	for (Element* child = element; child != ancestor; child = child->GetParentNode())
+	{
+		Element* parent = child->GetParentNode();
+		if (parent == nullptr)
+			return -1;
+
+		// Non-DOM children are stored after the DOM children, and there are usually few of them.
+		for (int i = parent->GetNumChildren(); i < parent->GetNumChildren(true); i++)
+		{
+			if (parent->GetChild(i) == child)
+				return -1;
+		}
+
+		depth++;
+	}
+
+	return depth;
+}
+
 Element* ElementUtilities::GetElementById(Element* root_element, const String& id)
 {
+	if (root_element->GetId() == id)
+		return root_element;
+
+	// Look up the element in the id index of our document. Of several elements with the same id, the breadth first
+	// search below would find the shallowest one first, so we do the same.
+	ElementDocument* document = root_element->GetOwnerDocument();
+	if (document != nullptr && !id.empty())
+	{
+		const ElementList* indexed_elements = document->GetIndexedElementsById(id);
+		if (indexed_elements == nullptr)
+			return nullptr;
+
+		Element* result = nullptr;
+		int result_depth = -1;
+		bool ambiguous = false;
+
+		for (Element* element : *indexed_elements)
+		{
+			const int depth = GetDomDepth(element, root_element);
+			if (depth < 0)
+				continue;
+
+			if (result == nullptr || depth < result_depth)
+			{
+				result = element;
+				result_depth = depth;
+				ambiguous = false;
+			}
+			else if (depth == result_depth)
+				ambiguous = true;
+		}
+
+		// Elements at the same depth are found in document order, which the index doesn't know.
+		if (!ambiguous)
+			return result;
+	}
+
 	// Breadth first search on elements for the corresponding id
 	typedef std::queue<Element*> SearchQueue;
 	SearchQueue search_queue;
@@ -100,6 +163,11 @@ Element* ElementUtilities::GetElementById(Element* root_element, const String& i
 
 void ElementUtilities::GetElementsByTagName(ElementList& elements, Element* root_element, const String& tag)
 {
+	// Look up the elements in the tag index of our document.
+	ElementDocument* document = root_element->GetOwnerDocument();
+	if (document != nullptr && document->GetIndexedDescendantsByTag(elements, root_element, tag))
+		return;
+
 	// Breadth first search on elements for the corresponding id
 	typedef std::queue< Element* > SearchQueue;
 	SearchQueue search_queue;
@@ -122,6 +190,11 @@ void ElementUtilities::GetElementsByTagName(ElementList& elements, Element* root
 
 void ElementUtilities::GetElementsByClassName(ElementList& elements, Element* root_element, const String& class_name)
 {
+	// Look up the elements in the class index of our document.
+	ElementDocument* document = root_element->GetOwnerDocument();
+	if (document != nullptr && document->GetIndexedDescendantsByClass(elements, root_element, class_name))
+		return;
+
 	// Breadth first search on elements for the corresponding id
 	typedef std::queue< Element* > SearchQueue;
 	SearchQueue search_queue;
@@ -142,6 +215,76 @@ void ElementUtilities::GetElementsByClassName(ElementList& elements, Element* ro
 	}
 }
 
+// Depth first search in document order, returns the first matching descendant.
+static Element* QuerySelectorRecursive(Element* element, const ElementSelector& selector)
+{
+	for (int i = 0; i < element->GetNumChildren(); i++)
+	{
+		Element* child = element->GetChild(i);
+		if (selector.Matches(child))
+			return child;
+
+		if (Element* result = QuerySelectorRecursive(child, selector))
+			return result;
+	}
+
+	return nullptr;
+}
+
+// Depth first search in document order, collects all matching descendants.
+static void QuerySelectorAllRecursive(ElementList& elements, Element* element, const ElementSelector& selector)
+{
+	for (int i = 0; i < element->GetNumChildren(); i++)
+	{
+		Element* child = element->GetChild(i);
+		if (selector.Matches(child))
+			elements.push_back(child);
+
+		QuerySelectorAllRecursive(elements, child, selector);
+	}
+}
+
+Element* ElementUtilities::QuerySelector(Element* root_element, const ElementSelector& selector)
+{
+	if (!selector.IsValid())
+		return nullptr;
+
+	// Look up the candidates for the selector's required id, class or tag in the indexes of our document.
+	ElementDocument* document = root_element->GetOwnerDocument();
+	ElementList candidates;
+	if (document != nullptr && document->GetIndexedSelectorCandidates(candidates, root_element, selector))
+	{
+		for (Element* element : candidates)
+		{
+			if (selector.Matches(element))
+				return element;
+		}
+		return nullptr;
+	}
+
+	return QuerySelectorRecursive(root_element, selector);
+}
+
+void ElementUtilities::QuerySelectorAll(ElementList& elements, Element* root_element, const ElementSelector& selector)
+{
+	if (!selector.IsValid())
+		return;
+
+	ElementDocument* document = root_element->GetOwnerDocument();
+	ElementList candidates;
+	if (document != nullptr && document->GetIndexedSelectorCandidates(candidates, root_element, selector))
+	{
+		for (Element* element : candidates)
+		{
+			if (selector.Matches(element))
+				elements.push_back(element);
+		}
+		return;
+	}
+
+	QuerySelectorAllRecursive(elements, root_element, selector);
+}
+
 float ElementUtilities::GetDensityIndependentPixelRatio(Element * element)
 {
 	Context* context = element->GetContext();
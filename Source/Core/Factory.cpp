@@ -30,6 +30,7 @@
 #include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/ContextInstancer.h"
 #include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/DataModel.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementInstancer.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
@@ -39,6 +40,8 @@
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 
 #include "ContextInstancerDefault.h"
+#include "DocumentCache.h"
+#include "DocumentHeader.h"
 #include "DecoratorTiledBoxInstancer.h"
 #include "DecoratorTiledHorizontalInstancer.h"
 #include "DecoratorTiledImageInstancer.h"
@@ -62,6 +65,7 @@
 #include "XMLNodeHandlerDefault.h"
 #include "XMLNodeHandlerHead.h"
 #include "XMLNodeHandlerTemplate.h"
+#include "XMLNodeTree.h"
 #include "XMLParseTools.h"
 
 namespace Rml {
@@ -246,6 +250,7 @@ ElementPtr Factory::InstanceElement(Element* parent, const String& instancer_nam
 			element->SetInstancer(instancer);
 			element->SetAttributes(attributes);
 			ElementUtilities::BindEventAttributes(element.get());
+			DataModel::BindAttributes(parent, element.get());
 
 			PluginRegistry::NotifyElementCreate(element.get());
 		}
@@ -312,6 +317,7 @@ bool Factory::InstanceElementText(Element* parent, const String& text)
 		}
 
 		text_element->SetText(translated_data);
+		DataModel::BindText(parent, text_element, translated_data);
 
 		// Add to active node.
 		parent->AppendChild(std::move(element));
@@ -328,11 +334,9 @@ bool Factory::InstanceElementStream(Element* parent, Stream* stream)
 	return true;
 }
 
-// Instances a element tree based on the stream
-ElementPtr Factory::InstanceDocumentStream(Rml::Core::Context* context, Stream* stream)
+// Instances the document element, ready for its contents to be parsed into it.
+static ElementPtr InstanceDocumentElement()
 {
-	RMLUI_ZoneScoped;
-
 	ElementPtr element = Factory::InstanceElement(nullptr, "body", "body", XMLAttributes());
 	if (!element)
 	{
@@ -347,7 +351,19 @@ ElementPtr Factory::InstanceDocumentStream(Rml::Core::Context* context, Stream*
 		return nullptr;
 	}
 
-	document->context = context;
+	return element;
+}
+
+// Instances a element tree based on the stream
+ElementPtr Factory::InstanceDocumentStream(Rml::Core::Context* context, Stream* stream)
+{
+	RMLUI_ZoneScoped;
+
+	ElementPtr element = InstanceDocumentElement();
+	if (!element)
+		return nullptr;
+
+	static_cast<ElementDocument*>(element.get())->context = context;
 
 	XMLParser parser(element.get());
 	parser.Parse(stream);
@@ -355,6 +371,24 @@ ElementPtr Factory::InstanceDocumentStream(Rml::Core::Context* context, Stream*
 	return element;
 }
 
+// Instances a element tree based on the pre-parsed nodes
+ElementPtr Factory::InstanceDocumentNodeTree(Rml::Core::Context* context, const XMLNodeTree& node_tree, const SharedPtr<StyleSheet>& style_sheet)
+{
+	RMLUI_ZoneScoped;
+
+	ElementPtr element = InstanceDocumentElement();
+	if (!element)
+		return nullptr;
+
+	static_cast<ElementDocument*>(element.get())->context = context;
+
+	XMLParser parser(element.get());
+	parser.GetDocumentHeader()->prepared_style_sheet = style_sheet;
+	node_tree.Parse(parser);
+
+	return element;
+}
+
 
 // Registers an instancer that will be used to instance decorators.
 void Factory::RegisterDecoratorInstancer(const String& name, DecoratorInstancer* instancer)
@@ -428,6 +462,12 @@ void Factory::ClearTemplateCache()
 	TemplateCache::Clear();
 }
 
+// Clears the document cache. This will force documents loaded from files to be re-read and parsed.
+void Factory::ClearDocumentCache()
+{
+	DocumentCache::Clear();
+}
+
 // Registers an instancer for all RmlEvents
 void Factory::RegisterEventInstancer(EventInstancer* instancer)
 {
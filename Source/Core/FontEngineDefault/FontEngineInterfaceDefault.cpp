@@ -29,10 +29,13 @@
 #include "FontProvider.h"
 #include "FontFaceHandleDefault.h"
 #include "FontEngineInterfaceDefault.h"
+#include <mutex>
 
 namespace Rml {
 namespace Core {
 
+static std::mutex string_width_mutex;
+
 FontEngineInterfaceDefault::FontEngineInterfaceDefault()
 {
 	FontProvider::Initialise();
@@ -97,6 +100,9 @@ float FontEngineInterfaceDefault::GetUnderline(FontFaceHandle handle, float& thi
 
 int FontEngineInterfaceDefault::GetStringWidth(FontFaceHandle handle, const String& string, Character prior_character)
 {
+	// Glyphs are loaded on demand while measuring, and documents may be laid out in parallel.
+	std::lock_guard<std::mutex> lock(string_width_mutex);
+
 	auto handle_default = reinterpret_cast<FontFaceHandleDefault *>(handle);
 	return handle_default->GetStringWidth(string, prior_character);
 }
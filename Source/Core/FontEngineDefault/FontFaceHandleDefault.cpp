@@ -257,8 +257,7 @@ int FontFaceHandleDefault::GenerateString(GeometryList& geometry, const String&
 		line_width = 0;
 		Character prior_character = Character::Null;
 
-		geometry[geometry_index].GetIndices().reserve(string.size() * 6);
-		geometry[geometry_index].GetVertices().reserve(string.size() * 4);
+		geometry[geometry_index].GetQuads().reserve(string.size());
 
 		for (auto it_string = StringIteratorU8(string); it_string; ++it_string)
 		{
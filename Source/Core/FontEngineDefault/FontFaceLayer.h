@@ -84,22 +84,15 @@ public:
 		if (box.texture_index < 0)
 			return;
 
-		// Generate the geometry for the character.
-		std::vector< Vertex >& character_vertices = geometry[box.texture_index].GetVertices();
-		std::vector< int >& character_indices = geometry[box.texture_index].GetIndices();
-
-		character_vertices.resize(character_vertices.size() + 4);
-		character_indices.resize(character_indices.size() + 6);
-		GeometryUtilities::GenerateQuad(
-			&character_vertices[0] + (character_vertices.size() - 4),
-			&character_indices[0] + (character_indices.size() - 6),
-			Vector2f(position.x + box.origin.x, position.y + box.origin.y).Round(),
-			box.dimensions,
-			colour,
-			box.texcoords[0],
-			box.texcoords[1],
-			(int)character_vertices.size() - 4
-		);
+		// Generate the quad for the character.
+		QuadInstance quad;
+		quad.position = Vector2f(position.x + box.origin.x, position.y + box.origin.y).Round();
+		quad.size = box.dimensions;
+		quad.tex_coord[0] = box.texcoords[0];
+		quad.tex_coord[1] = box.texcoords[1];
+		quad.colour = colour;
+
+		geometry[box.texture_index].GetQuads().push_back(quad);
 	}
 
 	/// Returns the effect used to generate the layer.
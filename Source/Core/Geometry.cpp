@@ -30,15 +30,22 @@
 #include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "GeometryDatabase.h"
+#include "TextureDatabase.h"
 #include <utility>
 
 
 namespace Rml {
 namespace Core {
 
+// Scratch buffers for geometry converted to the compact format, shared by all geometry as it is only rendered from the
+// main thread. The converted copy is only needed while it is submitted to the render interface.
+static std::vector< CompactVertex > compact_vertices;
+static std::vector< uint16_t > compact_indices;
+
 Geometry::Geometry(Element* host_element) : host_element(host_element)
 {
 	database_handle = GeometryDatabase::Insert(this);
@@ -69,11 +76,15 @@ void Geometry::MoveFrom(Geometry& other)
 
 	vertices = std::move(other.vertices);
 	indices = std::move(other.indices);
+	quads = std::move(other.quads);
 
 	texture = std::exchange(other.texture, nullptr);
 
 	compiled_geometry = std::exchange(other.compiled_geometry, 0);
+	compiled_texture = std::exchange(other.compiled_texture, 0);
+	compiled_texture_generation = std::exchange(other.compiled_texture_generation, 0);
 	compile_attempted = std::exchange(other.compile_attempted, false);
+	compact_convertible = std::exchange(other.compact_convertible, false);
 }
 
 Geometry::~Geometry()
@@ -81,6 +92,8 @@ Geometry::~Geometry()
 	GeometryDatabase::Erase(database_handle);
 
 	Release();
+
+	GeometryDatabase::RecycleBuffers(vertices, indices);
 }
 
 // Set the host element for this geometry; this should be passed in the constructor if possible.
@@ -104,6 +117,35 @@ void Geometry::Render(const Vector2f& translation)
 	if (!render_interface)
 		return;
 
+	// The texture handle may change if the texture is released and later reloaded, then the geometry must be recompiled.
+	// Handles only change after a release, so they need not be looked up again until the release generation changes.
+	if (compiled_geometry && texture)
+	{
+		const unsigned int release_generation = TextureDatabase::GetReleaseGeneration();
+		if (release_generation != compiled_texture_generation)
+		{
+			compiled_texture_generation = release_generation;
+			if (texture->GetHandle(render_interface) != compiled_texture)
+				Release();
+		}
+	}
+
+	if (!quads.empty())
+	{
+		// Submit the quads directly if possible, otherwise expand them into regular geometry once.
+		if (render_interface->SupportsQuads())
+		{
+			RMLUI_ZoneScopedN("RenderQuads");
+			render_interface->RenderQuads(&quads[0], (int)quads.size(), texture ? texture->GetHandle(render_interface) : 0, translation);
+		}
+		else
+		{
+			GeometryUtilities::ExpandQuads(&quads[0], (int)quads.size(), GetVertices(), GetIndices());
+			quads.clear();
+			Release();
+		}
+	}
+
 	// Render our compiled geometry if possible.
 	if (compiled_geometry)
 	{
@@ -120,15 +162,26 @@ void Geometry::Render(const Vector2f& translation)
 
 		RMLUI_ZoneScopedN("RenderGeometry");
 
+		bool compact_converted = false;
 		if (!compile_attempted)
 		{
 			compile_attempted = true;
-			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(render_interface) : 0);
+			compiled_texture = (texture ? texture->GetHandle(render_interface) : 0);
+			compiled_texture_generation = TextureDatabase::GetReleaseGeneration();
+
+			// Use the compact format if the render interface supports it and the geometry can be represented by it.
+			compact_convertible = (render_interface->SupportsCompactGeometry() && GeometryUtilities::ConvertToCompact(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), compact_vertices, compact_indices));
+			compact_converted = compact_convertible;
+
+			if (compact_convertible)
+				compiled_geometry = render_interface->CompileCompactGeometry(&compact_vertices[0], (int)compact_vertices.size(), &compact_indices[0], (int)compact_indices.size(), compiled_texture);
+			else
+				compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), compiled_texture);
 
 			// If we managed to compile the geometry, we can clear the local copy of vertices and indices and
 			// immediately render the compiled version.
 			if (compiled_geometry)
-			{	
+			{
 				render_interface->RenderCompiledGeometry(compiled_geometry, translation);
 				return;
 			}
@@ -136,22 +189,42 @@ void Geometry::Render(const Vector2f& translation)
 
 		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
 		// render the uncompiled version.
-		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(GetRenderInterface()) : 0, translation);
+		const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+		if (compact_convertible)
+		{
+			if (!compact_converted)
+				GeometryUtilities::ConvertToCompact(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), compact_vertices, compact_indices);
+			render_interface->RenderCompactGeometry(&compact_vertices[0], (int)compact_vertices.size(), &compact_indices[0], (int)compact_indices.size(), texture_handle, translation);
+		}
+		else
+			render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture_handle, translation);
 	}
 }
 
 // Returns the geometry's vertices. If these are written to, Release() should be called to force a recompile.
 std::vector< Vertex >& Geometry::GetVertices()
 {
+	if (vertices.capacity() == 0)
+		GeometryDatabase::AcquireBuffer(vertices);
+
 	return vertices;
 }
 
 // Returns the geometry's indices. If these are written to, Release() should be called to force a recompile.
 std::vector< int >& Geometry::GetIndices()
 {
+	if (indices.capacity() == 0)
+		GeometryDatabase::AcquireBuffer(indices);
+
 	return indices;
 }
 
+// Returns the geometry's quads. If these are written to, Release() should be called to force a recompile.
+std::vector< QuadInstance >& Geometry::GetQuads()
+{
+	return quads;
+}
+
 // Gets the geometry's texture.
 const Texture* Geometry::GetTexture() const
 {
@@ -179,6 +252,7 @@ void Geometry::Release(bool clear_buffers)
 	{
 		vertices.clear();
 		indices.clear();
+		quads.clear();
 	}
 }
 
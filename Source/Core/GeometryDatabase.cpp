@@ -28,12 +28,86 @@
 
 #include "GeometryDatabase.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/Vertex.h"
 #include <algorithm>
+#include <iterator>
+#include <mutex>
 
 namespace Rml {
 namespace Core {
 namespace GeometryDatabase {
 
+// Buffers with a larger capacity than this are released instead of recycled.
+static constexpr size_t max_recycled_buffer_bytes = 64 * 1024;
+// The maximum number of bytes held by the recycled buffers, for each buffer type.
+static constexpr size_t max_recycled_total_bytes = 4 * 1024 * 1024;
+// Recycled buffers are grouped by their capacity in bytes rounded down to a power of two, up to the largest buffer size.
+static constexpr int num_capacity_classes = 17;
+static_assert(size_t(1) << (num_capacity_classes - 1) == max_recycled_buffer_bytes, "The capacity classes must cover the recycled buffer sizes.");
+// Buffers more than this many capacity classes above the requested size are not handed out. Requests smaller than the
+// minimum size, including those of unknown size, are treated as requests of the minimum size.
+static constexpr int max_capacity_class_excess = 4;
+static constexpr size_t min_requested_bytes = 256;
+
+static int GetCapacityClass(size_t bytes)
+{
+	int capacity_class = 0;
+	while (bytes > 1 && capacity_class < num_capacity_classes - 1)
+	{
+		bytes >>= 1;
+		capacity_class++;
+	}
+	return capacity_class;
+}
+
+template<typename T>
+class BufferRecycler {
+public:
+	void recycle(std::vector<T>& buffer)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		const size_t buffer_bytes = buffer.capacity() * sizeof(T);
+		if (buffer_bytes == 0 || buffer_bytes > max_recycled_buffer_bytes || total_bytes + buffer_bytes > max_recycled_total_bytes)
+			return;
+
+		buffer.clear();
+		total_bytes += buffer_bytes;
+		buffers[GetCapacityClass(buffer_bytes)].push_back(std::move(buffer));
+	}
+
+	// Hands out the smallest recycled buffer that can hold the given number of elements, so that small geometry doesn't
+	// hold on to large buffers. Within a capacity class the most recently recycled buffer that fits is preferred.
+	void acquire(std::vector<T>& buffer, size_t min_size)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		const int min_class = GetCapacityClass(min_size * sizeof(T));
+		const int max_class = std::min(GetCapacityClass(std::max(min_size * sizeof(T), min_requested_bytes)) + max_capacity_class_excess, num_capacity_classes - 1);
+
+		for (int capacity_class = min_class; capacity_class <= max_class; capacity_class++)
+		{
+			std::vector<std::vector<T>>& class_buffers = buffers[capacity_class];
+			for (auto it = class_buffers.rbegin(); it != class_buffers.rend(); ++it)
+			{
+				if (it->capacity() < min_size)
+					continue;
+
+				total_bytes -= it->capacity() * sizeof(T);
+				buffer = std::move(*it);
+				class_buffers.erase(std::next(it).base());
+				return;
+			}
+		}
+	}
+
+private:
+	// Geometry may be created and destroyed on the layout and document loader threads.
+	std::mutex mutex;
+	std::vector<std::vector<T>> buffers[num_capacity_classes];
+	size_t total_bytes = 0;
+};
+
 class Database {
 public:
 	Database() {
@@ -55,6 +129,8 @@ public:
 
 	GeometryDatabaseHandle insert(Geometry* value)
 	{
+		std::lock_guard<std::mutex> lock(list_mutex);
+
 		GeometryDatabaseHandle handle;
 		if (free_list.empty())
 		{
@@ -72,6 +148,7 @@ public:
 
 	void erase(GeometryDatabaseHandle handle)
 	{
+		std::lock_guard<std::mutex> lock(list_mutex);
 		free_list.push_back(handle);
 	}
 
@@ -79,6 +156,8 @@ public:
 	template<typename Func>
 	void for_each(Func func)
 	{
+		std::lock_guard<std::mutex> lock(list_mutex);
+
 		std::sort(free_list.begin(), free_list.end());
 
 		size_t i_begin_next = 0;
@@ -96,7 +175,12 @@ public:
 				func(geometry_list[i]);
 	}
 
+	BufferRecycler<Vertex> vertex_recycler;
+	BufferRecycler<int> index_recycler;
+
 private:
+	// Guards the lists below, which are used by the geometry constructor and destructor on any thread.
+	std::mutex list_mutex;
 	// List of all active geometry, in addition to free slots.
 	// Free slots (as defined by the 'free_list') may contain dangling pointers and must not be dereferenced.
 	std::vector<Geometry*> geometry_list;
@@ -124,6 +208,22 @@ void ReleaseAll()
 	});
 }
 
+void RecycleBuffers(std::vector<Vertex>& vertices, std::vector<int>& indices)
+{
+	geometry_database.vertex_recycler.recycle(vertices);
+	geometry_database.index_recycler.recycle(indices);
+}
+
+void AcquireBuffer(std::vector<Vertex>& vertices, size_t min_size)
+{
+	geometry_database.vertex_recycler.acquire(vertices, min_size);
+}
+
+void AcquireBuffer(std::vector<int>& indices, size_t min_size)
+{
+	geometry_database.index_recycler.acquire(indices, min_size);
+}
+
 
 
 #ifdef RMLUI_TESTS_ENABLED
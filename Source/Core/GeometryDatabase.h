@@ -29,12 +29,15 @@
 #ifndef RMLUICOREGEOMETRYDATABASE_H
 #define RMLUICOREGEOMETRYDATABASE_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include <vector>
 
 namespace Rml {
 namespace Core {
 
 class Geometry;
+struct Vertex;
 using GeometryDatabaseHandle = uint32_t;
 
 /**
@@ -44,6 +47,12 @@ using GeometryDatabaseHandle = uint32_t;
 
     It is expected that every Insert() call is followed (at some later time) by
     exactly one Erase() call with the same handle value.
+
+    The database also recycles the vertex and index buffers of destroyed geometry,
+    so that geometry created in bulk, such as during document load or when
+    replacing the contents of an element, can reuse previously allocated memory.
+
+    All functions may be called from any thread.
 */
 
 namespace GeometryDatabase {
@@ -53,6 +62,12 @@ namespace GeometryDatabase {
 
     void ReleaseAll();
 
+    // Moves the buffers of geometry that is no longer used into the recycled buffers.
+    void RecycleBuffers(std::vector<Vertex>& vertices, std::vector<int>& indices);
+    // Replaces the given buffer with the smallest recycled buffer that can hold the given number of elements, if any.
+    void AcquireBuffer(std::vector<Vertex>& vertices, size_t min_size = 0);
+    void AcquireBuffer(std::vector<int>& indices, size_t min_size = 0);
+
 }
 
 }
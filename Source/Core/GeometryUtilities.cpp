@@ -30,6 +30,7 @@
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/FontEngineInterface.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
 namespace Rml {
@@ -77,6 +78,60 @@ void GeometryUtilities::GenerateQuad(Vertex* vertices, int* indices, const Vecto
 	indices[5] = index_offset + 2;
 }
 
+// Converts geometry to the compact vertex format with 16-bit indices.
+bool GeometryUtilities::ConvertToCompact(const Vertex* vertices, int num_vertices, const int* indices, int num_indices, std::vector<CompactVertex>& compact_vertices, std::vector<uint16_t>& compact_indices)
+{
+	constexpr int max_vertices = 1 << 16;
+	if (num_vertices > max_vertices)
+		return false;
+
+	compact_vertices.resize(num_vertices);
+	compact_indices.resize(num_indices);
+
+	for (int i = 0; i < num_vertices; i++)
+	{
+		const Vertex& vertex = vertices[i];
+		CompactVertex& compact_vertex = compact_vertices[i];
+
+		for (int j = 0; j < 2; j++)
+		{
+			const float tex_coord = vertex.tex_coord[j];
+			if (!(tex_coord >= 0.f && tex_coord <= 1.f))
+			{
+				compact_vertices.clear();
+				compact_indices.clear();
+				return false;
+			}
+
+			compact_vertex.tex_coord[j] = (int16_t)Math::RoundToInteger(tex_coord * 32767.f);
+		}
+
+		compact_vertex.position = vertex.position;
+		compact_vertex.colour = vertex.colour;
+	}
+
+	for (int i = 0; i < num_indices; i++)
+		compact_indices[i] = (uint16_t)indices[i];
+
+	return true;
+}
+
+// Expands quad instances into regular geometry.
+void GeometryUtilities::ExpandQuads(const QuadInstance* quads, int num_quads, std::vector<Vertex>& vertices, std::vector<int>& indices)
+{
+	const int index_offset = (int)vertices.size();
+	const size_t first_index = indices.size();
+
+	vertices.resize(vertices.size() + 4 * num_quads);
+	indices.resize(indices.size() + 6 * num_quads);
+
+	for (int i = 0; i < num_quads; i++)
+	{
+		const QuadInstance& quad = quads[i];
+		GenerateQuad(&vertices[index_offset + 4 * i], &indices[first_index + 6 * i], quad.position, quad.size, quad.colour, quad.tex_coord[0], quad.tex_coord[1], index_offset + 4 * i);
+	}
+}
+
 // Generates the geometry required to render a line above, below or through a line of text.
 void GeometryUtilities::GenerateLine(FontFaceHandle font_face_handle, Geometry* geometry, const Vector2f& position, int width, Style::TextDecoration height, const Colourb& colour)
 {
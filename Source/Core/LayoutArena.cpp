@@ -0,0 +1,160 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "LayoutArena.h"
+#include "../../Include/RmlUi/Core/Debug.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include <atomic>
+
+namespace Rml {
+namespace Core {
+
+// The size of the first page, later pages double in size.
+static const size_t initial_page_size = 16 * 1024;
+
+struct LayoutArenaPage
+{
+	UniquePtr< byte[] > data;
+	size_t size;
+};
+
+// Each thread has its own arena, so that documents can be laid out in parallel.
+struct LayoutArenaState
+{
+	~LayoutArenaState();
+
+	// The pages of the arena, we only allocate from the last one.
+	std::vector< LayoutArenaPage > pages;
+	size_t page_offset = 0;
+	int pass_depth = 0;
+
+	// The number of bytes used by the current pass, including alignment padding.
+	size_t pass_usage = 0;
+	// The number of allocations made by the current pass.
+	int pass_allocations = 0;
+};
+
+static thread_local LayoutArenaState arena;
+
+// Statistics summed over all threads.
+static std::atomic< int > num_passes(0);
+static std::atomic< int > num_allocations(0);
+static std::atomic< int > num_heap_allocations(0);
+static std::atomic< size_t > arena_size(0);
+
+static void AddPage(size_t size)
+{
+	arena.pages.push_back(LayoutArenaPage{ UniquePtr< byte[] >(new byte[size]), size });
+	arena.page_offset = 0;
+	num_heap_allocations++;
+	arena_size += size;
+}
+
+static void ReleasePages()
+{
+	for (const LayoutArenaPage& page : arena.pages)
+		arena_size -= page.size;
+	arena.pages.clear();
+}
+
+LayoutArenaState::~LayoutArenaState()
+{
+	ReleasePages();
+}
+
+void LayoutArena::BeginPass()
+{
+	if (arena.pass_depth++ == 0)
+		num_passes++;
+}
+
+void LayoutArena::EndPass()
+{
+	RMLUI_ASSERT(arena.pass_depth > 0);
+	if (--arena.pass_depth > 0)
+		return;
+
+	// If the last pass needed more than one page, replace them by a single page with some headroom over the memory
+	// used. This way, later passes of a similar size will not need to allocate any memory.
+	if (arena.pages.size() > 1)
+	{
+		ReleasePages();
+		AddPage(arena.pass_usage + arena.pass_usage / 4);
+	}
+
+	num_allocations += arena.pass_allocations;
+
+	arena.page_offset = 0;
+	arena.pass_usage = 0;
+	arena.pass_allocations = 0;
+}
+
+void* LayoutArena::Allocate(size_t size, size_t alignment)
+{
+	RMLUI_ASSERTMSG(arena.pass_depth > 0, "Layout memory can only be allocated during a layout pass.");
+	RMLUI_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	arena.pass_allocations++;
+
+	if (!arena.pages.empty())
+	{
+		LayoutArenaPage& page = arena.pages.back();
+		const uintptr_t begin = reinterpret_cast<uintptr_t>(page.data.get());
+		const uintptr_t aligned = (begin + arena.page_offset + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		const size_t offset = size_t(aligned - begin);
+
+		if (offset + size <= page.size)
+		{
+			arena.pass_usage += offset + size - arena.page_offset;
+			arena.page_offset = offset + size;
+			return page.data.get() + offset;
+		}
+	}
+
+	AddPage(Math::Max(size + alignment, arena.pages.empty() ? initial_page_size : 2 * arena.pages.back().size));
+
+	LayoutArenaPage& page = arena.pages.back();
+	const uintptr_t begin = reinterpret_cast<uintptr_t>(page.data.get());
+	const uintptr_t aligned = (begin + alignment - 1) & ~(uintptr_t)(alignment - 1);
+	arena.page_offset = size_t(aligned - begin) + size;
+	arena.pass_usage += arena.page_offset;
+
+	return reinterpret_cast<void*>(aligned);
+}
+
+LayoutMemoryStatistics LayoutArena::GetStatistics()
+{
+	LayoutMemoryStatistics statistics;
+	statistics.num_passes = num_passes;
+	statistics.num_allocations = num_allocations;
+	statistics.num_heap_allocations = num_heap_allocations;
+	statistics.arena_size = arena_size;
+	return statistics;
+}
+}
+}
@@ -0,0 +1,98 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICORELAYOUTARENA_H
+#define RMLUICORELAYOUTARENA_H
+
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Types.h"
+#include <cstddef>
+
+namespace Rml {
+namespace Core {
+
+/**
+	A monotonic memory arena for the boxes and containers created during layout. Memory is handed out by bumping an
+	offset into the current page, and is never freed individually; the whole arena is rewound in one step when the
+	outermost layout pass ends. Layout passes started while another pass is in progress, such as when formatting
+	inline-blocks, share the arena of the outer pass. Each thread has its own arena.
+ */
+
+class LayoutArena
+{
+public:
+	/// Starts a layout pass. Passes may be nested.
+	static void BeginPass();
+	/// Ends a layout pass. When the outermost pass ends, all memory allocated during the pass is released at once.
+	static void EndPass();
+
+	/// Allocates memory from the arena. Must only be called during a layout pass.
+	/// @param[in] size The number of bytes to allocate.
+	/// @param[in] alignment The alignment of the memory, must be a power of two.
+	/// @return The allocated memory, valid until the end of the outermost layout pass.
+	static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+	/// Returns the allocation statistics of all layout passes so far.
+	static LayoutMemoryStatistics GetStatistics();
+};
+
+
+/**
+	An STL allocator handing out memory from the layout arena, deallocation is a no-op.
+ */
+
+template < typename T >
+class LayoutArenaAllocator
+{
+public:
+	using value_type = T;
+
+	LayoutArenaAllocator() = default;
+	template < typename U >
+	LayoutArenaAllocator(const LayoutArenaAllocator< U >&) {}
+
+	T* allocate(size_t n)
+	{
+		return static_cast<T*>(LayoutArena::Allocate(n * sizeof(T), alignof(T)));
+	}
+	void deallocate(T*, size_t) {}
+};
+
+template < typename T, typename U >
+inline bool operator==(const LayoutArenaAllocator< T >&, const LayoutArenaAllocator< U >&) { return true; }
+template < typename T, typename U >
+inline bool operator!=(const LayoutArenaAllocator< T >&, const LayoutArenaAllocator< U >&) { return false; }
+
+// A vector whose storage is allocated from the layout arena, only to be used by objects living in the arena.
+template < typename T >
+using LayoutVector = std::vector< T, LayoutArenaAllocator< T > >;
+
+}
+}
+
+#endif
@@ -34,11 +34,14 @@
 #include "../../Include/RmlUi/Core/ElementScroll.h"
 #include "../../Include/RmlUi/Core/Property.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include <atomic>
 #include <float.h>
 
 namespace Rml {
 namespace Core {
 
+static std::atomic< int > num_restarts(0);
+
 // Creates a new block box for rendering a block element.
 LayoutBlockBox::LayoutBlockBox(LayoutEngine* _layout_engine, LayoutBlockBox* _parent, Element* _element) : position(0, 0)
 {
@@ -55,6 +58,8 @@ LayoutBlockBox::LayoutBlockBox(LayoutEngine* _layout_engine, LayoutBlockBox* _pa
 
 	box_cursor = 0;
 	vertical_overflow = false;
+	cache_vertical_overflow = false;
+	vertical_overflow_stamp = 0;
 
 	// Get our offset root from our parent, if it has one; otherwise, our element is the offset parent.
 	if (parent != nullptr &&
@@ -115,7 +120,23 @@ LayoutBlockBox::LayoutBlockBox(LayoutEngine* _layout_engine, LayoutBlockBox* _pa
 		else
 			element->GetElementScroll()->DisableScrollbar(ElementScroll::HORIZONTAL);
 
-		if (overflow_y_property == Style::Overflow::Scroll)
+		// If our content overflowed at the full width when last formatted, and neither the content nor our size has
+		// changed since, it will overflow again. Then we enable the automatic scrollbar up front, which saves us from
+		// formatting our content twice. Floats from outside our box could also change our content, so it is only
+		// cached when there are none.
+		if (overflow_y_property == Style::Overflow::Auto && GetOverflowHeight() >= 0 && space->IsEmpty())
+		{
+			vertical_overflow_box = Vector2f(box.GetSize().x, GetOverflowHeight());
+			if (element->GetCachedVerticalOverflow(vertical_overflow_box))
+				vertical_overflow = true;
+			else
+			{
+				cache_vertical_overflow = true;
+				vertical_overflow_stamp = element->BeginLayoutMeasurement();
+			}
+		}
+
+		if (overflow_y_property == Style::Overflow::Scroll || vertical_overflow)
 			element->GetElementScroll()->EnableScrollbar(ElementScroll::VERTICAL, box.GetSize(Box::PADDING).x);
 		else
 			element->GetElementScroll()->DisableScrollbar(ElementScroll::VERTICAL);
@@ -147,6 +168,8 @@ LayoutBlockBox::LayoutBlockBox(LayoutEngine* _layout_engine, LayoutBlockBox* _pa
 
 	box_cursor = 0;
 	vertical_overflow = false;
+	cache_vertical_overflow = false;
+	vertical_overflow_stamp = 0;
 
 	layout_engine->BuildBox(box, min_height, max_height, parent, nullptr);
 	parent->PositionBlockBox(position, box, Style::Clear::None);
@@ -239,6 +262,7 @@ LayoutBlockBox::CloseResult LayoutBlockBox::Close()
 
 			content_box.y = box_cursor;
 			content_box.y = Math::Max(content_box.y, space_box.y);
+
 			if (!CatchVerticalOverflow(content_box.y))
 				return LAYOUT_SELF;
 
@@ -669,30 +693,21 @@ bool LayoutBlockBox::CatchVerticalOverflow(float cursor)
 	if (cursor == -1)
 		cursor = box_cursor;
 
-	float box_height = box.GetSize().y;
-	if (box_height < 0)
-		box_height = max_height;
-
 	// If we're auto-scrolling and our height is fixed, we have to check if this box has exceeded our client height.
 	if (!vertical_overflow &&
-		box_height >= 0 &&
 		overflow_y_property == Style::Overflow::Auto)
 	{
-		if (cursor > box_height - element->GetElementScroll()->GetScrollbarSize(ElementScroll::HORIZONTAL))
+		const float overflow_height = GetOverflowHeight();
+		if (overflow_height >= 0 && cursor > overflow_height)
 		{
 			RMLUI_ZoneScopedC(0xDD3322);
 			vertical_overflow = true;
 			element->GetElementScroll()->EnableScrollbar(ElementScroll::VERTICAL, box.GetSize(Box::PADDING).x);
 
-			for (size_t i = 0; i < block_boxes.size(); i++)
-				delete block_boxes[i];
-			block_boxes.clear();
+			if (cache_vertical_overflow)
+				element->SetCachedVerticalOverflow(vertical_overflow_box, vertical_overflow_stamp);
 
-			delete space;
-			space = new LayoutBlockBoxSpace(this);
-
-			box_cursor = 0;
-			interrupted_chain = nullptr;
+			ClearContent();
 
 			return false;
 		}
@@ -701,5 +716,39 @@ bool LayoutBlockBox::CatchVerticalOverflow(float cursor)
 	return true;
 }
 
+// Returns the height available to our content before an automatic vertical scrollbar is needed.
+float LayoutBlockBox::GetOverflowHeight() const
+{
+	float box_height = box.GetSize().y;
+	if (box_height < 0)
+		box_height = max_height;
+
+	if (box_height < 0)
+		return -1;
+
+	return box_height - element->GetElementScroll()->GetScrollbarSize(ElementScroll::HORIZONTAL);
+}
+
+// Destroys our block boxes and floating space, so our content can be formatted again.
+void LayoutBlockBox::ClearContent()
+{
+	num_restarts++;
+
+	for (size_t i = 0; i < block_boxes.size(); i++)
+		delete block_boxes[i];
+	block_boxes.clear();
+
+	delete space;
+	space = new LayoutBlockBoxSpace(this);
+
+	box_cursor = 0;
+	interrupted_chain = nullptr;
+}
+
+int LayoutBlockBox::GetNumRestarts()
+{
+	return num_restarts;
+}
+
 }
 }
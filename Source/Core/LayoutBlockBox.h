@@ -162,6 +162,10 @@ public:
 	void* operator new(size_t size);
 	void operator delete(void* chunk);
 
+	/// Returns the number of times block boxes have discarded their contents to be formatted again, because their
+	/// vertical scrollbar appeared.
+	static int GetNumRestarts();
+
 private:
 	struct AbsoluteElement
 	{
@@ -179,10 +183,15 @@ private:
 	// be enabled and our block boxes will be destroyed. All content will need to re-formatted. Returns true if no
 	// overflow occured, false if it did.
 	bool CatchVerticalOverflow(float cursor = -1);
+	// Returns the height available to our content before an automatic vertical scrollbar is needed, or -1 if our
+	// height is not fixed.
+	float GetOverflowHeight() const;
+	// Destroys our block boxes and floating space, so our content can be formatted again.
+	void ClearContent();
 
-	typedef std::vector< AbsoluteElement > AbsoluteElementList;
-	typedef std::vector< LayoutBlockBox* > BlockBoxList;
-	typedef std::vector< LayoutLineBox* > LineBoxList;
+	typedef LayoutVector< AbsoluteElement > AbsoluteElementList;
+	typedef LayoutVector< LayoutBlockBox* > BlockBoxList;
+	typedef LayoutVector< LayoutLineBox* > LineBoxList;
 
 	// The object managing our space, as occupied by floating elements of this box and our ancestors.
 	LayoutBlockBoxSpace* space;
@@ -227,6 +236,11 @@ private:
 	Style::Overflow overflow_y_property;
 	// Used by block contexts only; if true, we've enabled our vertical scrollbar.
 	bool vertical_overflow;
+	// Used by block contexts only; if true, a vertical overflow caught at the full width is cached on our element with
+	// the content width and overflow height below, and the layout change stamp our element had before formatting.
+	bool cache_vertical_overflow;
+	Vector2f vertical_overflow_box;
+	unsigned int vertical_overflow_stamp;
 
 	// Used by inline contexts only; stores the list of line boxes flowing inline content.
 	LineBoxList line_boxes;
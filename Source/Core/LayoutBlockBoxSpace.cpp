@@ -31,6 +31,7 @@
 #include "LayoutEngine.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementScroll.h"
+#include <algorithm>
 #include <float.h>
 
 namespace Rml {
@@ -48,12 +49,9 @@ LayoutBlockBoxSpace::~LayoutBlockBoxSpace()
 // Imports boxes from another block into this space.
 void LayoutBlockBoxSpace::ImportSpace(const LayoutBlockBoxSpace& space)
 {
-	// Copy all the boxes from the parent into this space. Could do some optimisation here!
+	// Copy all the boxes from the parent into this space.
 	for (int i = 0; i < NUM_ANCHOR_EDGES; ++i)
-	{
-		for (size_t j = 0; j < space.boxes[i].size(); ++j)
-			boxes[i].push_back(space.boxes[i][j]);
-	}
+		boxes[i].insert(boxes[i].end(), space.boxes[i].begin(), space.boxes[i].end());
 }
 
 // Generates the position for a box of a given size within a containing block box.
@@ -83,7 +81,13 @@ float LayoutBlockBoxSpace::PositionBox(float cursor, Element* element)
 	PositionBox(element_offset, cursor, element_size, float_property);
 
 	// It's been placed, so we can now add it to our list of floating boxes.
-	boxes[float_property == Style::Float::Left ? LEFT : RIGHT].push_back(SpaceBox(element_offset, element_size));
+	SpaceBoxList& edge_boxes = boxes[float_property == Style::Float::Left ? LEFT : RIGHT];
+	RMLUI_ASSERT(edge_boxes.empty() || edge_boxes.back().offset.y <= element_offset.y);
+
+	SpaceBox space_box(element_offset, element_size);
+	if (!edge_boxes.empty())
+		space_box.max_bottom = Math::Max(space_box.max_bottom, edge_boxes.back().max_bottom);
+	edge_boxes.push_back(space_box);
 
 	// Set our offset and dimensions (if necessary) so they enclose the new box.
 	Vector2f normalised_offset = element_offset - (parent->GetPosition() + parent->GetBox().GetPosition());
@@ -105,19 +109,17 @@ float LayoutBlockBoxSpace::ClearBoxes(float cursor, Style::Clear clear_property)
 {
 	using namespace Style;
 	// Clear left boxes.
-	if (clear_property == Clear::Left ||
-		clear_property == Clear::Both)
+	if ((clear_property == Clear::Left || clear_property == Clear::Both) &&
+		!boxes[LEFT].empty())
 	{
-		for (size_t i = 0; i < boxes[LEFT].size(); ++i)
-			cursor = Math::Max(cursor, boxes[LEFT][i].offset.y + boxes[LEFT][i].dimensions.y);
+		cursor = Math::Max(cursor, boxes[LEFT].back().max_bottom);
 	}
 
 	// Clear right boxes.
-	if (clear_property == Clear::Right ||
-		clear_property == Clear::Both)
+	if ((clear_property == Clear::Right || clear_property == Clear::Both) &&
+		!boxes[RIGHT].empty())
 	{
-		for (size_t i = 0; i < boxes[RIGHT].size(); ++i)
-			cursor = Math::Max(cursor, boxes[RIGHT][i].offset.y + boxes[RIGHT][i].dimensions.y);
+		cursor = Math::Max(cursor, boxes[RIGHT].back().max_bottom);
 	}
 
 	return cursor;
@@ -138,10 +140,16 @@ float LayoutBlockBoxSpace::PositionBox(Vector2f& box_position, float cursor, con
 
 	float next_cursor = FLT_MAX;
 
+	// Find the boxes on either edge which may intersect our vertical extent, the other boxes can be skipped.
+	size_t range_begin[NUM_ANCHOR_EDGES];
+	size_t range_end[NUM_ANCHOR_EDGES];
+	for (int i = 0; i < NUM_ANCHOR_EDGES; ++i)
+		GetBoxRange(range_begin[i], range_end[i], (AnchorEdge) i, box_position.y, box_position.y + dimensions.y);
+
 	// First up; we iterate through all boxes that share our edge, pushing ourself to the side of them if we intersect
 	// them. We record the height of the lowest box that gets in our way; in the event we can't be positioned at this
 	// height, we'll reposition ourselves at that height for the next iteration.
-	for (size_t i = 0; i < boxes[box_edge].size(); ++i)
+	for (size_t i = range_begin[box_edge]; i < range_end[box_edge]; ++i)
 	{
 		const SpaceBox& fixed_box = boxes[box_edge][i];
 
@@ -187,7 +195,7 @@ float LayoutBlockBoxSpace::PositionBox(Vector2f& box_position, float cursor, con
 	// maximum width the box can stretch to, if it is placed at this location.
 	float maximum_box_width = box_edge == LEFT ? parent_edge - box_position.x : box_position.x + dimensions.x;
 
-	for (size_t i = 0; i < boxes[1 - box_edge].size(); ++i)
+	for (size_t i = range_begin[1 - box_edge]; i < range_end[1 - box_edge]; ++i)
 	{
 		const SpaceBox& fixed_box = boxes[1 - box_edge][i];
 
@@ -224,7 +232,7 @@ float LayoutBlockBoxSpace::PositionBox(Vector2f& box_position, float cursor, con
 	// Third; we go through all of the boxes (on both sides), checking for vertical collisions.
 	for (int i = 0; i < 2; ++i)
 	{
-		for (size_t j = 0; j < boxes[i].size(); ++j)
+		for (size_t j = range_begin[i]; j < range_end[i]; ++j)
 		{
 			const SpaceBox& fixed_box = boxes[i][j];
 
@@ -256,6 +264,25 @@ float LayoutBlockBoxSpace::PositionBox(Vector2f& box_position, float cursor, con
 	return maximum_box_width;
 }
 
+// Finds the range of boxes on one edge which may vertically intersect a given interval.
+void LayoutBlockBoxSpace::GetBoxRange(size_t& begin, size_t& end, AnchorEdge edge, float top, float bottom) const
+{
+	const SpaceBoxList& edge_boxes = boxes[edge];
+
+	// All boxes before the first one with a running maximum bottom edge below our top are above the interval.
+	auto it_begin = std::upper_bound(edge_boxes.begin(), edge_boxes.end(), top, [](float y, const SpaceBox& box) {
+		return y < box.max_bottom;
+	});
+
+	// All boxes from the first one with its top edge at or below our bottom are below the interval.
+	auto it_end = std::lower_bound(it_begin, edge_boxes.end(), bottom, [](const SpaceBox& box, float y) {
+		return box.offset.y < y;
+	});
+
+	begin = size_t(it_begin - edge_boxes.begin());
+	end = size_t(it_end - edge_boxes.begin());
+}
+
 // Returns the top-left offset of the boxes within the space.
 const Vector2f& LayoutBlockBoxSpace::GetOffset() const
 {
@@ -268,6 +295,17 @@ Vector2f LayoutBlockBoxSpace::GetDimensions() const
 	return dimensions - offset;
 }
 
+bool LayoutBlockBoxSpace::IsEmpty() const
+{
+	for (int i = 0; i < NUM_ANCHOR_EDGES; ++i)
+	{
+		if (!boxes[i].empty())
+			return false;
+	}
+
+	return true;
+}
+
 void* LayoutBlockBoxSpace::operator new(size_t size)
 {
 	return LayoutEngine::AllocateLayoutChunk(size);
@@ -278,11 +316,11 @@ void LayoutBlockBoxSpace::operator delete(void* chunk)
 	LayoutEngine::DeallocateLayoutChunk(chunk);
 }
 
-LayoutBlockBoxSpace::SpaceBox::SpaceBox() : offset(0, 0), dimensions(0, 0)
+LayoutBlockBoxSpace::SpaceBox::SpaceBox() : offset(0, 0), dimensions(0, 0), max_bottom(0)
 {
 }
 
-LayoutBlockBoxSpace::SpaceBox::SpaceBox(const Vector2f& offset, const Vector2f& dimensions) : offset(offset), dimensions(dimensions)
+LayoutBlockBoxSpace::SpaceBox::SpaceBox(const Vector2f& offset, const Vector2f& dimensions) : offset(offset), dimensions(dimensions), max_bottom(offset.y + dimensions.y)
 {
 }
 
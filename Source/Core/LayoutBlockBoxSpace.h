@@ -29,6 +29,7 @@
 #ifndef RMLUICORELAYOUTBLOCKBOXSPACE_H
 #define RMLUICORELAYOUTBLOCKBOXSPACE_H
 
+#include "LayoutArena.h"
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
@@ -82,6 +83,8 @@ public:
 	/// Returns the dimensions of the boxes within the space.
 	/// @return The space's dimensions.
 	Vector2f GetDimensions() const;
+	/// Returns true if no boxes have been placed or imported into the space.
+	bool IsEmpty() const;
 
 	void* operator new(size_t size);
 	void operator delete(void* chunk);
@@ -102,6 +105,15 @@ private:
 	/// @return The maximum width at the box position.
 	float PositionBox(Vector2f& box_position, float cursor, const Vector2f& dimensions, Style::Float float_property = Style::Float::None) const;
 
+	/// Finds the range of boxes on one edge which may vertically intersect a given interval. Boxes outside the range
+	/// are guaranteed not to intersect it.
+	/// @param[out] begin The index of the first box in the range.
+	/// @param[out] end The index one past the last box in the range.
+	/// @param[in] edge The edge the boxes are floated against.
+	/// @param[in] top The top of the vertical interval.
+	/// @param[in] bottom The bottom of the vertical interval.
+	void GetBoxRange(size_t& begin, size_t& end, AnchorEdge edge, float top, float bottom) const;
+
 	struct SpaceBox
 	{
 		SpaceBox();
@@ -109,9 +121,14 @@ private:
 
 		Vector2f offset;
 		Vector2f dimensions;
+		// The lowest bottom edge of this box and all boxes before it on the same edge.
+		float max_bottom;
 	};
 
-	typedef std::vector< SpaceBox > SpaceBoxList;
+	// Floats are never placed higher than an earlier float, so each list is sorted by the top edge of its boxes, and
+	// by their running maximum bottom edge. This lets us find the boxes intersecting a vertical interval by binary
+	// search, instead of visiting every box.
+	typedef LayoutVector< SpaceBox > SpaceBoxList;
 
 	// Our block-box parent.
 	LayoutBlockBox* parent;
@@ -28,9 +28,10 @@
 
 #include "LayoutEngine.h"
 #include "../../Include/RmlUi/Core/Math.h"
-#include "Pool.h"
+#include "LayoutArena.h"
 #include "LayoutBlockBoxSpace.h"
 #include "LayoutInlineBoxText.h"
+#include "LayoutScheduler.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementScroll.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
@@ -43,16 +44,6 @@
 namespace Rml {
 namespace Core {
 
-#define MAX(a, b) (a > b ? a : b)
-
-struct LayoutChunk
-{
-	static const unsigned int size = MAX(sizeof(LayoutBlockBox), MAX(sizeof(LayoutInlineBox), MAX(sizeof(LayoutInlineBoxText), MAX(sizeof(LayoutLineBox), sizeof(LayoutBlockBoxSpace)))));
-	alignas(std::max_align_t) char buffer[size];
-};
-
-static Pool< LayoutChunk > layout_chunk_pool(200, true);
-
 LayoutEngine::LayoutEngine()
 {
 	block_box = nullptr;
@@ -72,8 +63,26 @@ bool LayoutEngine::FormatElement(Element* element, const Vector2f& containing_bl
 	RMLUI_ZoneName(name.c_str(), name.size());
 #endif
 
+	// If the content of a shrink-to-fit element hasn't changed since it was last measured, we can format it directly at
+	// its shrunk width.
+	Vector2f block_size = containing_block;
+	float cached_content_width = 0;
+	unsigned int shrink_to_fit_stamp = 0;
+	if (shrink_to_fit)
+	{
+		if (element->GetCachedShrinkToFitWidth(cached_content_width, containing_block))
+		{
+			block_size.x = Math::Min(cached_content_width, containing_block.x);
+			shrink_to_fit = false;
+		}
+		else
+			shrink_to_fit_stamp = element->BeginLayoutMeasurement();
+	}
+
+	LayoutArena::BeginPass();
+
 	block_box = new LayoutBlockBox(this, nullptr, nullptr);
-	block_box->GetBox().SetContent(containing_block);
+	block_box->GetBox().SetContent(block_size);
 
 	block_context_box = block_box->AddBlockElement(element);
 
@@ -87,6 +96,7 @@ bool LayoutEngine::FormatElement(Element* element, const Vector2f& containing_bl
 	{
 		// For inline blocks with 'auto' width, we want to shrink the box back to its inner content width, recreating the LayoutBlockBox.
 		float content_width = block_box->InternalContentWidth();
+		element->SetCachedShrinkToFitWidth(content_width, containing_block, shrink_to_fit_stamp);
 
 		if (content_width < containing_block.x)
 		{
@@ -108,12 +118,28 @@ bool LayoutEngine::FormatElement(Element* element, const Vector2f& containing_bl
 		}
 	}
 
-	block_context_box->Close();
+	// Our vertical scrollbar may have been enabled when closing, in which case the children are formatted again.
+	while (block_context_box->Close() == LayoutBlockBox::LAYOUT_SELF)
+	{
+		for (int i = 0; i < element->GetNumChildren(); i++)
+		{
+			if (!FormatElement(element->GetChild(i)))
+				i = -1;
+		}
+	}
+
 	block_context_box->CloseAbsoluteElements();
 
-	element->OnLayout();
+	{
+		LayoutSharedLock lock;
+		element->OnLayout();
+	}
 
 	delete block_box;
+	block_box = nullptr;
+
+	LayoutArena::EndPass();
+
 	return true;
 }
 
@@ -147,10 +173,17 @@ void LayoutEngine::BuildBox(Box& box, const Vector2f& containing_block, Element*
 	// Calculate the size of the content area.
 	Vector2f content_area(-1, -1);
 	bool replaced_element = false;
+	bool has_intrinsic_dimensions = false;
+
+	{
+		// Replaced elements may need to load their resources to know their dimensions.
+		LayoutSharedLock lock;
+		has_intrinsic_dimensions = element->GetIntrinsicDimensions(content_area);
+	}
 
 	// If the element has intrinsic dimensions, then we use those as the basis for the content area and only adjust
 	// them if a non-auto style has been applied to them.
-	if (element->GetIntrinsicDimensions(content_area))
+	if (has_intrinsic_dimensions)
 	{
 		replaced_element = true;
 
@@ -261,15 +294,14 @@ float LayoutEngine::ClampHeight(float height, const ComputedValues& computed, fl
 
 void* LayoutEngine::AllocateLayoutChunk(size_t size)
 {
-	RMLUI_ASSERT(size <= LayoutChunk::size);
-	(void)size;
-	
-	return layout_chunk_pool.AllocateAndConstruct();
+	return LayoutArena::Allocate(size);
 }
 
-void LayoutEngine::DeallocateLayoutChunk(void* chunk)
+void LayoutEngine::DeallocateLayoutChunk(void* RMLUI_UNUSED_PARAMETER(chunk))
 {
-	layout_chunk_pool.DestroyAndDeallocate((LayoutChunk*) chunk);
+	RMLUI_UNUSED(chunk);
+
+	// Layout boxes are released along with the rest of the arena when the layout pass ends.
 }
 
 // Positions a single element and its children within this layout.
@@ -343,22 +375,23 @@ bool LayoutEngine::FormatElementBlock(Element* element)
 
 	// Close the block box, and check the return code; we may have overflowed either this element or our parent.
 	new_block_context_box = block_context_box->GetParent();
-	switch (block_context_box->Close())
+	LayoutBlockBox::CloseResult result = block_context_box->Close();
+
+	// We need to reformat ourself; format all of our children again and close the box. This happens at most once, as
+	// our vertical scrollbar is only enabled once.
+	while (result == LayoutBlockBox::LAYOUT_SELF)
 	{
-		// We need to reformat ourself; format all of our children again and close the box. No need to check for error
-		// codes, as we already have our vertical slider bar.
-		case LayoutBlockBox::LAYOUT_SELF:
+		for (int i = 0; i < element->GetNumChildren(); i++)
 		{
-			for (int i = 0; i < element->GetNumChildren(); i++)
-				FormatElement(element->GetChild(i));
-
-			if (block_context_box->Close() == LayoutBlockBox::OK)
-			{
-				element->OnLayout();
-				break;
-			}
+			if (!FormatElement(element->GetChild(i)))
+				i = -1;
 		}
-		//-fallthrough
+
+		result = block_context_box->Close();
+	}
+
+	switch (result)
+	{
 		// We caused our parent to add a vertical scrollbar; bail out!
 		case LayoutBlockBox::LAYOUT_PARENT:
 		{
@@ -368,7 +401,10 @@ bool LayoutEngine::FormatElementBlock(Element* element)
 		break;
 
 		default:
+		{
+			LayoutSharedLock lock;
 			element->OnLayout();
+		}
 	}
 
 	block_context_box = new_block_context_box;
@@ -424,6 +460,8 @@ bool LayoutEngine::FormatElementSpecial(Element* element)
 	if (element->GetTagName() == br)
 	{
 		block_context_box->AddBreak();
+
+		LayoutSharedLock lock;
 		element->OnLayout();
 		return true;
 	}
@@ -29,6 +29,7 @@
 #include "LayoutInlineBox.h"
 #include "LayoutBlockBox.h"
 #include "LayoutEngine.h"
+#include "LayoutScheduler.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
@@ -344,6 +345,9 @@ void LayoutInlineBox::SizeElement(bool split)
 		element_box.SetEdge(Box::PADDING, Box::RIGHT, 0);
 	}
 
+	// Element callbacks must not run concurrently with those of other documents.
+	LayoutSharedLock lock;
+
 	// The elements of a chained box have already had their positions set by the first link.
 	if (chained)
 	{
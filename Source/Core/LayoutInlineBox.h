@@ -29,6 +29,7 @@
 #ifndef RMLUICORELAYOUTINLINEBOX_H
 #define RMLUICORELAYOUTINLINEBOX_H
 
+#include "LayoutArena.h"
 #include "../../Include/RmlUi/Core/Box.h"
 #include "../../Include/RmlUi/Core/ComputedValues.h"
 
@@ -165,7 +166,7 @@ protected:
 	// This inline box's line.
 	LayoutLineBox* line;
 
-	std::vector< LayoutInlineBox* > children;
+	LayoutVector< LayoutInlineBox* > children;
 
 	// The next link in our element's chain of inline boxes.
 	LayoutInlineBox* chain;
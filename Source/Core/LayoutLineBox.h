@@ -98,7 +98,7 @@ private:
 	/// Appends an inline box to the end of the line box's list of inline boxes.
 	void AppendBox(LayoutInlineBox* box);
 
-	typedef std::vector< LayoutInlineBox* > InlineBoxList;
+	typedef LayoutVector< LayoutInlineBox* > InlineBoxList;
 
 	// The block box containing this line.
 	LayoutBlockBox* parent;
@@ -0,0 +1,176 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "LayoutScheduler.h"
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Rml {
+namespace Core {
+
+static std::vector< std::thread > workers;
+
+// Guards the job state below, workers wait on the job condition until a new job generation is posted.
+static std::mutex job_mutex;
+static std::condition_variable job_condition;
+static std::condition_variable job_done_condition;
+static const std::vector< ElementDocument* >* job_documents = nullptr;
+static unsigned int job_generation = 0;
+static int job_pending_workers = 0;
+static bool stop_workers = false;
+
+// The index of the next document to be laid out by any thread taking part in the current job.
+static std::atomic< size_t > job_next_document(0);
+
+static std::atomic< bool > parallel_layout_active(false);
+static std::recursive_mutex shared_state_mutex;
+
+void LayoutScheduler::RunJob(const std::vector< ElementDocument* >& documents)
+{
+	for (size_t i = job_next_document++; i < documents.size(); i = job_next_document++)
+		documents[i]->UpdateLayout();
+}
+
+void LayoutScheduler::RunWorker(unsigned int generation)
+{
+	std::unique_lock< std::mutex > lock(job_mutex);
+	while (true)
+	{
+		job_condition.wait(lock, [&generation] { return stop_workers || job_generation != generation; });
+		if (stop_workers)
+			return;
+
+		generation = job_generation;
+		const std::vector< ElementDocument* >* documents = job_documents;
+
+		// The job may have finished before this worker saw it, in which case it's not counted among its workers.
+		if (!documents)
+			continue;
+
+		lock.unlock();
+		RunJob(*documents);
+		lock.lock();
+
+		if (--job_pending_workers == 0)
+			job_done_condition.notify_one();
+	}
+}
+
+void LayoutScheduler::SetNumThreads(int num_threads)
+{
+	Shutdown();
+
+	// Workers may be started again after earlier jobs have been run, so they start out from the current generation.
+	// It is read here rather than by the workers, as they should take part in any job posted after we return.
+	unsigned int generation = 0;
+	{
+		std::lock_guard< std::mutex > lock(job_mutex);
+		generation = job_generation;
+	}
+
+	for (int i = 0; i < num_threads; i++)
+		workers.emplace_back(RunWorker, generation);
+}
+
+void LayoutScheduler::Shutdown()
+{
+	{
+		std::lock_guard< std::mutex > lock(job_mutex);
+		stop_workers = true;
+	}
+	job_condition.notify_all();
+
+	for (std::thread& worker : workers)
+		worker.join();
+	workers.clear();
+
+	stop_workers = false;
+}
+
+void LayoutScheduler::UpdateLayout(const std::vector< ElementDocument* >& documents)
+{
+	std::vector< ElementDocument* > dirty_documents;
+	if (!workers.empty())
+	{
+		for (ElementDocument* document : documents)
+		{
+			if (document->IsLayoutDirty())
+				dirty_documents.push_back(document);
+		}
+	}
+
+	if (dirty_documents.size() < 2)
+	{
+		for (ElementDocument* document : documents)
+			document->UpdateLayout();
+		return;
+	}
+
+	RMLUI_ZoneScopedN("ParallelLayout");
+
+	parallel_layout_active = true;
+
+	{
+		std::lock_guard< std::mutex > lock(job_mutex);
+		job_documents = &dirty_documents;
+		job_next_document = 0;
+		job_pending_workers = (int)workers.size();
+		job_generation++;
+	}
+	job_condition.notify_all();
+
+	// Take part in the job ourselves, then wait for the workers to finish their documents.
+	RunJob(dirty_documents);
+
+	{
+		std::unique_lock< std::mutex > lock(job_mutex);
+		job_done_condition.wait(lock, [] { return job_pending_workers == 0; });
+		job_documents = nullptr;
+	}
+
+	parallel_layout_active = false;
+}
+
+LayoutSharedLock::LayoutSharedLock() : locked(parallel_layout_active)
+{
+	if (locked)
+		shared_state_mutex.lock();
+}
+
+LayoutSharedLock::~LayoutSharedLock()
+{
+	if (locked)
+		shared_state_mutex.unlock();
+}
+
+}
+}
@@ -0,0 +1,84 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICORELAYOUTSCHEDULER_H
+#define RMLUICORELAYOUTSCHEDULER_H
+
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+namespace Core {
+
+class ElementDocument;
+
+/**
+	Schedules the layout of documents. Documents are laid out independently of each other, so when parallel layout is
+	enabled they are formatted concurrently on a pool of worker threads, with the calling thread taking part.
+ */
+
+class LayoutScheduler
+{
+public:
+	/// Sets the number of worker threads used for laying out documents in parallel.
+	/// @param[in] num_threads The number of worker threads, or zero to lay out all documents on the calling thread.
+	static void SetNumThreads(int num_threads);
+	/// Stops and joins all worker threads.
+	static void Shutdown();
+
+	/// Updates the layout of the given documents, in parallel if enabled and more than one of them needs layout.
+	/// @param[in] documents The documents to update.
+	static void UpdateLayout(const std::vector< ElementDocument* >& documents);
+
+private:
+	// Lays out documents of the current job until none are left, called by the workers and the scheduling thread.
+	static void RunJob(const std::vector< ElementDocument* >& documents);
+	// The main loop of the worker threads, taking part in the jobs posted after the given generation.
+	static void RunWorker(unsigned int generation);
+};
+
+
+/**
+	Serialises code touching state shared between documents while documents are laid out in parallel, such as element
+	callbacks, the element factory and texture loading. Does nothing when no parallel layout is in progress.
+ */
+
+class LayoutSharedLock : public NonCopyMoveable
+{
+public:
+	LayoutSharedLock();
+	~LayoutSharedLock();
+
+private:
+	bool locked;
+};
+
+}
+}
+
+#endif
@@ -39,7 +39,7 @@ RenderInterface::RenderInterface()
 
 RenderInterface::~RenderInterface()
 {
-	TextureDatabase::ReleaseTextures(this);
+	TextureDatabase::ReleaseTextures(this, true);
 }
 
 // Called by RmlUi when it wants to compile geometry it believes will be static for the forseeable future.
@@ -58,12 +58,46 @@ void RenderInterface::ReleaseCompiledGeometry(CompiledGeometryHandle /*geometry*
 {
 }
 
+// Called by RmlUi to query whether the application supports geometry in the compact vertex format.
+bool RenderInterface::SupportsCompactGeometry()
+{
+	return false;
+}
+
+// Called by RmlUi when it wants to render geometry in the compact format.
+void RenderInterface::RenderCompactGeometry(CompactVertex* /*vertices*/, int /*num_vertices*/, uint16_t* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/, const Vector2f& /*translation*/)
+{
+}
+
+// Called by RmlUi when it wants to compile geometry in the compact format.
+CompiledGeometryHandle RenderInterface::CompileCompactGeometry(CompactVertex* /*vertices*/, int /*num_vertices*/, uint16_t* /*indices*/, int /*num_indices*/, TextureHandle /*texture*/)
+{
+	return 0;
+}
+
+// Called by RmlUi to query whether the application supports rendering quad instances directly.
+bool RenderInterface::SupportsQuads()
+{
+	return false;
+}
+
+// Called by RmlUi when it wants to render a list of quads.
+void RenderInterface::RenderQuads(QuadInstance* /*quads*/, int /*num_quads*/, TextureHandle /*texture*/, const Vector2f& /*translation*/)
+{
+}
+
 // Called by RmlUi when a texture is required by the library.
 bool RenderInterface::LoadTexture(TextureHandle& /*texture_handle*/, Vector2i& /*texture_dimensions*/, const String& /*source*/)
 {
 	return false;
 }
 
+// Called by RmlUi when a texture is to be packed into a runtime texture atlas.
+bool RenderInterface::LoadTextureData(UniquePtr<const byte[]>& /*texture_data*/, Vector2i& /*texture_dimensions*/, const String& /*source*/)
+{
+	return false;
+}
+
 // Called by RmlUi when a texture is required to be built from an internally-generated sequence of pixels.
 bool RenderInterface::GenerateTexture(TextureHandle& /*texture_handle*/, const byte* /*source*/, const Vector2i& /*source_dimensions*/)
 {
@@ -41,10 +41,15 @@
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include "../../Include/RmlUi/Core/FontEffectInstancer.h"
 #include <algorithm>
+#include <mutex>
 
 namespace Rml {
 namespace Core {
 
+// Guards the node hierarchies of style sheets while sheets are combined, as documents loaded in the background combine
+// cached sheets which may at the same time be indexed for a document on the main thread.
+static std::mutex node_hierarchy_mutex;
+
 // Sorts style nodes based on specificity.
 inline static bool StyleSheetNodeSort(const StyleSheetNode* lhs, const StyleSheetNode* rhs)
 {
@@ -55,6 +60,7 @@ StyleSheet::StyleSheet()
 {
 	root = std::make_unique<StyleSheetNode>();
 	specificity_offset = 0;
+	has_structural_selectors = false;
 }
 
 StyleSheet::~StyleSheet()
@@ -73,6 +79,8 @@ SharedPtr<StyleSheet> StyleSheet::CombineStyleSheet(const StyleSheet& other_shee
 {
 	RMLUI_ZoneScoped;
 
+	std::lock_guard<std::mutex> lock(node_hierarchy_mutex);
+
 	SharedPtr<StyleSheet> new_sheet = std::make_shared<StyleSheet>();
 	if (!new_sheet->root->MergeHierarchy(root.get()) ||
 		!new_sheet->root->MergeHierarchy(other_sheet.root.get(), specificity_offset))
@@ -111,9 +119,10 @@ SharedPtr<StyleSheet> StyleSheet::CombineStyleSheet(const StyleSheet& other_shee
 void StyleSheet::BuildNodeIndexAndOptimizeProperties()
 {
 	RMLUI_ZoneScoped;
+	std::lock_guard<std::mutex> lock(node_hierarchy_mutex);
 	styled_node_index.clear();
 	root->BuildIndexAndOptimizeProperties(styled_node_index, *this);
-	root->SetStructurallyVolatileRecursive(false);
+	has_structural_selectors = root->SetStructurallyVolatileRecursive(false);
 }
 
 // Returns the Keyframes of the given name, or null if it does not exist.
@@ -133,6 +142,11 @@ SharedPtr<Decorator> StyleSheet::GetDecorator(const String& name) const
 	return it->second.decorator;
 }
 
+bool StyleSheet::HasStructuralSelectors() const
+{
+	return has_structural_selectors;
+}
+
 const Sprite* StyleSheet::GetSprite(const String& name) const
 {
 	return spritesheet_list.GetSprite(name);
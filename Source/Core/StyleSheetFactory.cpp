@@ -28,6 +28,8 @@
 
 #include "StyleSheetFactory.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "DocumentHeader.h"
 #include "StyleSheetNode.h"
 #include "StreamFile.h"
 #include "StyleSheetNodeSelectorNthChild.h"
@@ -93,6 +95,8 @@ void StyleSheetFactory::Shutdown()
 
 SharedPtr<StyleSheet> StyleSheetFactory::GetStyleSheet(const String& sheet_name)
 {
+	std::lock_guard<std::recursive_mutex> lock(instance->cache_mutex);
+
 	// Look up the sheet definition in the cache
 	StyleSheets::iterator itr = instance->stylesheets.find(sheet_name);
 	if (itr != instance->stylesheets.end())
@@ -113,6 +117,8 @@ SharedPtr<StyleSheet> StyleSheetFactory::GetStyleSheet(const String& sheet_name)
 
 SharedPtr<StyleSheet> StyleSheetFactory::GetStyleSheet(const StringList& sheets)
 {
+	std::lock_guard<std::recursive_mutex> lock(instance->cache_mutex);
+
 	// Generate a unique key for these sheets
 	String combined_key;
 	for (size_t i = 0; i < sheets.size(); i++)
@@ -155,9 +161,41 @@ SharedPtr<StyleSheet> StyleSheetFactory::GetStyleSheet(const StringList& sheets)
 	return sheet;
 }
 
+SharedPtr<StyleSheet> StyleSheetFactory::GetDocumentStyleSheet(const DocumentHeader& header, const String& source_url)
+{
+	std::lock_guard<std::recursive_mutex> lock(instance->cache_mutex);
+
+	SharedPtr<StyleSheet> new_style_sheet;
+	if (header.rcss_external.size() > 0)
+		new_style_sheet = GetStyleSheet(header.rcss_external);
+
+	// Combine any inline sheets.
+	for (size_t i = 0; i < header.rcss_inline.size(); i++)
+	{
+		UniquePtr<StyleSheet> inline_sheet = std::make_unique<StyleSheet>();
+		auto stream = std::make_unique<StreamMemory>((const byte*) header.rcss_inline[i].c_str(), header.rcss_inline[i].size());
+		stream->SetSourceURL(source_url);
+
+		if (inline_sheet->LoadStyleSheet(stream.get(), header.rcss_inline_line_numbers[i]))
+		{
+			if (new_style_sheet)
+			{
+				SharedPtr<StyleSheet> combined_sheet = new_style_sheet->CombineStyleSheet(*inline_sheet);
+				new_style_sheet = combined_sheet;
+			}
+			else
+				new_style_sheet = std::move(inline_sheet);
+		}
+	}
+
+	return new_style_sheet;
+}
+
 // Clear the style sheet cache.
 void StyleSheetFactory::ClearStyleSheetCache()
 {
+	std::lock_guard<std::recursive_mutex> lock(instance->cache_mutex);
+
 	instance->stylesheets.clear();
 	instance->stylesheet_cache.clear();
 }
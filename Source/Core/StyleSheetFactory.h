@@ -30,10 +30,12 @@
 #define RMLUICORESTYLESHEETFACTORY_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
 
 namespace Rml {
 namespace Core {
 
+class DocumentHeader;
 class StyleSheet;
 class StyleSheetNodeSelector;
 struct StructuralSelector;
@@ -61,6 +63,11 @@ public:
 	/// @param sheets List of sheets to combine into one	
 	static SharedPtr<StyleSheet> GetStyleSheet(const StringList& sheets);
 
+	/// Builds the style sheet of a document from the external and inline sheets of its header
+	/// @param header The document header, with the external sheet paths already resolved
+	/// @param source_url The URL of the document, used as the source of its inline sheets
+	static SharedPtr<StyleSheet> GetDocumentStyleSheet(const DocumentHeader& header, const String& source_url);
+
 	/// Clear the style sheet cache.
 	static void ClearStyleSheetCache();
 
@@ -83,6 +90,9 @@ private:
 	// Cache of combined style sheets
 	StyleSheets stylesheet_cache;
 
+	// Guards the caches, as documents loaded in the background build their style sheets on a worker thread.
+	std::recursive_mutex cache_mutex;
+
 	// Custom complex selectors available for style sheets.
 	typedef UnorderedMap< String, StyleSheetNodeSelector* > SelectorMap;
 	SelectorMap selectors;
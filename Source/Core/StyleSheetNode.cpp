@@ -267,12 +267,19 @@ inline bool StyleSheetNode::MatchStructuralSelector(const Element* element) cons
 }
 
 // Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
-bool StyleSheetNode::IsApplicable(const Element* const in_element) const
+bool StyleSheetNode::IsApplicable(const Element* const in_element, bool skip_id_tag) const
 {
-	// This function is called with an element that matches a style node only with the tag name and id. We have to determine
-	// here whether or not it also matches the required hierarchy.
-	
-	// First, check locally for matching class and pseudo class. Id and tag have already been checked in StyleSheet.
+	// This function is usually called with an element that matches a style node only with the tag name and id. We have to
+	// determine here whether or not it also matches the required hierarchy.
+	if (!skip_id_tag)
+	{
+		if (!tag.empty() && tag != in_element->GetTagName())
+			return false;
+		if (!id.empty() && id != in_element->GetId())
+			return false;
+	}
+
+	// Check locally for matching class and pseudo class. Id and tag have already been checked in StyleSheet.
 	if (!MatchClassPseudoClass(in_element))
 		return false;
 
@@ -303,6 +310,21 @@ bool StyleSheetNode::IsApplicable(const Element* const in_element) const
 	return true;
 }
 
+const String& StyleSheetNode::GetTag() const
+{
+	return tag;
+}
+
+const String& StyleSheetNode::GetId() const
+{
+	return id;
+}
+
+const StringList& StyleSheetNode::GetClassNames() const
+{
+	return class_names;
+}
+
 bool StyleSheetNode::IsStructurallyVolatile() const
 {
 	return is_structurally_volatile;
@@ -87,7 +87,16 @@ public:
 	const PropertyDictionary& GetProperties() const;
 
 	/// Returns true if this node is applicable to the given element, given its IDs, classes and heritage.
-	bool IsApplicable(const Element* element) const;
+	/// @param[in] element The element to test.
+	/// @param[in] skip_id_tag True if the element's tag and id are already known to match, as when looked up through the style sheet's index.
+	bool IsApplicable(const Element* element, bool skip_id_tag = true) const;
+
+	/// Returns the tag required by this node, or an empty string if any tag is accepted.
+	const String& GetTag() const;
+	/// Returns the id required by this node, or an empty string if any id is accepted.
+	const String& GetId() const;
+	/// Returns the classes required by this node.
+	const StringList& GetClassNames() const;
 
 	/// Returns the specificity of this node.
 	int GetSpecificity() const;
@@ -406,8 +406,8 @@ int StyleSheetParser::Parse(StyleSheetNode* node, Stream* _stream, const StyleSh
 					}
 					else if (at_rule_identifier == "spritesheet")
 					{
-						// This is reasonably heavy to initialize, so we make it static
-						static SpritesheetPropertyParser spritesheet_property_parser;
+						// This is reasonably heavy to initialize, so we make it static, per thread as sheets may be parsed by the document loader
+						static thread_local SpritesheetPropertyParser spritesheet_property_parser;
 						spritesheet_property_parser.Clear();
 
 						ReadProperties(spritesheet_property_parser);
@@ -608,6 +608,16 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser, b
 
 // Updates the StyleNode tree, creating new nodes as necessary, setting the definition index
 bool StyleSheetParser::ImportProperties(StyleSheetNode* node, String rule_name, const PropertyDictionary& properties, int rule_specificity)
+{
+	StyleSheetNode* leaf_node = CreateSelectorNodes(node, std::move(rule_name));
+
+	// Merge the new properties with those already on the leaf node.
+	leaf_node->ImportProperties(properties, rule_specificity);
+
+	return true;
+}
+
+StyleSheetNode* StyleSheetParser::CreateSelectorNodes(StyleSheetNode* node, String rule_name)
 {
 	StyleSheetNode* leaf_node = node;
 
@@ -693,10 +703,7 @@ bool StyleSheetParser::ImportProperties(StyleSheetNode* node, String rule_name,
 		leaf_node = leaf_node->GetOrCreateChildNode(std::move(tag), std::move(id), std::move(classes), std::move(pseudo_classes), std::move(structural_pseudo_classes), child_combinator);
 	}
 
-	// Merge the new properties with those already on the leaf node.
-	leaf_node->ImportProperties(properties, rule_specificity);
-
-	return true;
+	return leaf_node;
 }
 
 char StyleSheetParser::FindToken(String& buffer, const char* tokens, bool remove_token)
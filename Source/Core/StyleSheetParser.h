@@ -65,6 +65,13 @@ public:
 	/// @return True if the parse was successful, or false if an error occured.
 	bool ParseProperties(PropertyDictionary& parsed_properties, const String& properties);
 
+	/// Creates the chain of nodes described by a single selector below the given node, reusing any existing nodes
+	/// with equal requirements.
+	/// @param node The node to create the chain under, usually the root node.
+	/// @param rule_name The selector, without any commas.
+	/// @return The leaf node of the selector.
+	static StyleSheetNode* CreateSelectorNodes(StyleSheetNode* node, String rule_name);
+
 private:
 	// Stream we're parsing from.
 	Stream* stream;
@@ -104,20 +104,18 @@ bool Template::Load(Stream* stream)
 
 	header = *parser.GetDocumentHeader();
 
-	// Store the body in stream form
-	body = std::make_unique<StreamMemory>(body_end - body_start);	
-	body->SetSourceURL(stream->GetSourceURL());
-	body->PushBack(body_start, body_end - body_start);
+	// Parse the body once and store its nodes, so that instancing the template doesn't need to tokenize it again
+	auto body_stream = std::make_unique<StreamMemory>((const byte*) body_start, body_end - body_start);
+	body_stream->SetSourceURL(stream->GetSourceURL());
+	body.Load(body_stream.get());
 
 	return true;
 }
 
 Element* Template::ParseTemplate(Element* element)
 {
-	body->Seek(0, SEEK_SET);
-
 	XMLParser parser(element);
-	parser.Parse(body.get());
+	body.Parse(parser);
 
 	// If theres an inject attribute on the template, 
 	// attempt to find the required element
@@ -31,6 +31,7 @@
 
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "DocumentHeader.h"
+#include "XMLNodeTree.h"
 
 namespace Rml {
 namespace Core {
@@ -38,7 +39,7 @@ namespace Core {
 class Element;
 
 /**
-	Contains a RML template. The Header is stored in parsed form, body in an unparsed stream.
+	Contains a RML template. The Header is stored in parsed form, body as a pre-parsed node tree.
 
 	@author Lloyd Weehuizen
  */
@@ -67,7 +68,7 @@ private:
 	String name;
 	String content;
 	DocumentHeader header;
-	UniquePtr<StreamMemory> body;
+	XMLNodeTree body;
 };
 
 }
@@ -73,6 +73,15 @@ Vector2i Texture::GetDimensions(RenderInterface* render_interface) const
 	return resource->GetDimensions(render_interface);
 }
 
+// Maps normalized texture coordinates to the coordinates to be used with the texture's handle.
+Vector2f Texture::MapTexCoord(RenderInterface* render_interface, const Vector2f& texcoord) const
+{
+	if (!resource)
+		return texcoord;
+
+	return resource->MapTexCoord(render_interface, texcoord);
+}
+
 bool Texture::operator==(const Texture& other) const
 {
 	return resource == other.resource;
@@ -0,0 +1,239 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TextureAtlas.h"
+#include "TextureResource.h"
+#include "../../Include/RmlUi/Core/Math.h"
+#include <algorithm>
+#include <string.h>
+
+namespace Rml {
+namespace Core {
+
+// Each image is surrounded by a border of its own edge pixels, so that texture filtering does not bleed in neighbouring images.
+static const int atlas_border = 1;
+
+struct TextureAtlas::PageData {
+	struct Row {
+		int y;
+		int height;
+		int width;
+		int num_images;
+	};
+
+	UniquePtr<byte[]> pixels;
+	Vector2i dimensions;
+	std::vector<Row> rows;
+	int rows_height = 0;
+	bool generated = false;
+	bool dirty = false;
+};
+
+TextureAtlas::TextureAtlas(int max_image_dimensions, int page_dimensions) : page_dimensions(page_dimensions)
+{
+	this->max_image_dimensions = Math::Min(max_image_dimensions, page_dimensions - 2 * atlas_border);
+}
+
+TextureAtlas::~TextureAtlas()
+{
+}
+
+bool TextureAtlas::Accepts(const Vector2i& dimensions) const
+{
+	return dimensions.x > 0 && dimensions.y > 0 && dimensions.x <= max_image_dimensions && dimensions.y <= max_image_dimensions;
+}
+
+bool TextureAtlas::Add(RenderInterface* render_interface, const byte* data, const Vector2i& dimensions, SharedPtr<TextureResource>& page, Vector2f texcoords[2])
+{
+	if (!Accepts(dimensions))
+		return false;
+
+	const Vector2i cell_dimensions = dimensions + Vector2i(2 * atlas_border);
+
+	Page* target_page = nullptr;
+	PageData::Row* target_row = nullptr;
+
+	for (Page& existing_page : pages)
+	{
+		if (existing_page.render_interface != render_interface)
+			continue;
+
+		PageData& page_data = *existing_page.data;
+
+		// Find the lowest existing row the image fits in.
+		for (PageData::Row& row : page_data.rows)
+		{
+			if (row.height >= cell_dimensions.y && row.width + cell_dimensions.x <= page_data.dimensions.x &&
+				(!target_row || row.height < target_row->height))
+				target_row = &row;
+		}
+
+		// Otherwise, start a new row if there is room for it.
+		if (!target_row && page_data.rows_height + cell_dimensions.y <= page_data.dimensions.y)
+		{
+			page_data.rows.push_back(PageData::Row{ page_data.rows_height, cell_dimensions.y, 0, 0 });
+			page_data.rows_height += cell_dimensions.y;
+			target_row = &page_data.rows.back();
+		}
+
+		if (target_row)
+		{
+			target_page = &existing_page;
+			break;
+		}
+	}
+
+	if (!target_page)
+	{
+		pages.push_back(CreatePage(render_interface));
+		target_page = &pages.back();
+
+		PageData& page_data = *target_page->data;
+		page_data.rows.push_back(PageData::Row{ 0, cell_dimensions.y, 0, 0 });
+		page_data.rows_height = cell_dimensions.y;
+		target_row = &page_data.rows.back();
+	}
+
+	PageData& page_data = *target_page->data;
+	const Vector2i position(target_row->width + atlas_border, target_row->y + atlas_border);
+	target_row->width += cell_dimensions.x;
+	target_row->num_images += 1;
+
+	// Copy the image into the page, extending its edge pixels into the border.
+	const int page_stride = page_data.dimensions.x * 4;
+	const int image_stride = dimensions.x * 4;
+
+	for (int y = -atlas_border; y < dimensions.y + atlas_border; y++)
+	{
+		const int source_y = Math::Clamp(y, 0, dimensions.y - 1);
+		const byte* source_row = data + source_y * image_stride;
+		byte* destination_row = page_data.pixels.get() + (position.y + y) * page_stride + position.x * 4;
+
+		memcpy(destination_row, source_row, image_stride);
+
+		for (int x = 1; x <= atlas_border; x++)
+		{
+			memcpy(destination_row - x * 4, source_row, 4);
+			memcpy(destination_row + image_stride + (x - 1) * 4, source_row + image_stride - 4, 4);
+		}
+	}
+
+	const Vector2f page_dimensions_f((float)page_data.dimensions.x, (float)page_data.dimensions.y);
+	texcoords[0] = Vector2f((float)position.x, (float)position.y) / page_dimensions_f;
+	texcoords[1] = Vector2f((float)(position.x + dimensions.x), (float)(position.y + dimensions.y)) / page_dimensions_f;
+
+	if (page_data.generated)
+		page_data.dirty = true;
+
+	page = target_page->resource;
+
+	return true;
+}
+
+void TextureAtlas::Remove(const TextureResource* page, const Vector2f texcoords[2], const Vector2i& dimensions)
+{
+	auto it_page = std::find_if(pages.begin(), pages.end(), [page](const Page& existing_page) { return existing_page.resource.get() == page; });
+	if (it_page == pages.end())
+		return;
+
+	PageData& page_data = *it_page->data;
+	const Vector2i cell_position(
+		Math::RoundToInteger(texcoords[0].x * (float)page_data.dimensions.x) - atlas_border,
+		Math::RoundToInteger(texcoords[0].y * (float)page_data.dimensions.y) - atlas_border
+	);
+	const int cell_width = dimensions.x + 2 * atlas_border;
+
+	auto it_row = std::find_if(page_data.rows.begin(), page_data.rows.end(), [&cell_position](const PageData::Row& row) { return row.y == cell_position.y; });
+	if (it_row == page_data.rows.end() || it_row->num_images <= 0)
+		return;
+
+	// Space can only be reclaimed at the end of a row, or once the row is empty.
+	it_row->num_images -= 1;
+	if (it_row->num_images == 0)
+		it_row->width = 0;
+	else if (cell_position.x + cell_width == it_row->width)
+		it_row->width = cell_position.x;
+
+	// Empty rows at the bottom of the page are removed, so that the space can be taken by rows of any height.
+	while (!page_data.rows.empty() && page_data.rows.back().num_images == 0)
+	{
+		page_data.rows_height -= page_data.rows.back().height;
+		page_data.rows.pop_back();
+	}
+
+	if (page_data.rows.empty())
+		pages.erase(it_page);
+}
+
+void TextureAtlas::Update()
+{
+	for (Page& page : pages)
+	{
+		if (page.data->dirty)
+		{
+			page.resource->Release();
+			page.data->dirty = false;
+		}
+	}
+}
+
+TextureAtlas::Page TextureAtlas::CreatePage(RenderInterface* render_interface)
+{
+	Page page;
+	page.render_interface = render_interface;
+	page.data = std::make_shared<PageData>();
+
+	PageData& page_data = *page.data;
+	page_data.dimensions = Vector2i(page_dimensions);
+
+	const size_t num_bytes = size_t(page_dimensions) * size_t(page_dimensions) * 4;
+	page_data.pixels.reset(new byte[num_bytes]);
+	memset(page_data.pixels.get(), 0, num_bytes);
+
+	// The page data is shared with the texture callback, so that the page can be regenerated after its texture has been released.
+	SharedPtr<PageData> data = page.data;
+	TextureCallback texture_callback = [data](const String& /*name*/, UniquePtr<const byte[]>& texture_data, Vector2i& dimensions) -> bool {
+		const size_t num_bytes = size_t(data->dimensions.x) * size_t(data->dimensions.y) * 4;
+		byte* pixels = new byte[num_bytes];
+		memcpy(pixels, data->pixels.get(), num_bytes);
+
+		texture_data.reset(pixels);
+		dimensions = data->dimensions;
+		data->generated = true;
+		data->dirty = false;
+		return true;
+	};
+
+	page.resource = std::make_shared<TextureResource>();
+	page.resource->Set("texture-atlas", texture_callback);
+
+	return page;
+}
+
+}
+}
@@ -0,0 +1,98 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICORETEXTUREATLAS_H
+#define RMLUICORETEXTUREATLAS_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+namespace Core {
+
+class RenderInterface;
+class TextureResource;
+
+/**
+	A texture atlas packs small images into shared texture pages at runtime, so that elements using different images
+	can be rendered with the same texture.
+
+	Images are placed on a page as they are added, and the page texture is generated when its handle is first requested.
+	Images added to a page after its texture has been generated only become visible once the page texture is
+	regenerated during the next call to Update(). Images are packed in rows; the space of removed images is reclaimed
+	at the end of their row, rows without images are reused, and pages without images are released.
+ */
+
+class TextureAtlas
+{
+public:
+	/// @param[in] max_image_dimensions The maximum width and height of images to be packed into the atlas.
+	/// @param[in] page_dimensions The width and height of each atlas page.
+	TextureAtlas(int max_image_dimensions, int page_dimensions);
+	~TextureAtlas();
+
+	/// Returns true if an image of the given dimensions is small enough to be packed into the atlas.
+	bool Accepts(const Vector2i& dimensions) const;
+
+	/// Packs an image into an open page of the atlas.
+	/// @param[in] render_interface The render interface the page texture will be generated for.
+	/// @param[in] data The raw 8-bit image data, each pixel has four 8-bit channels: red-green-blue-alpha.
+	/// @param[in] dimensions The dimensions of the image.
+	/// @param[out] page The texture resource of the page the image was placed on.
+	/// @param[out] texcoords The texture coordinates of the top-left and bottom-right corners of the image within the page.
+	/// @return True if the image was placed on a page.
+	bool Add(RenderInterface* render_interface, const byte* data, const Vector2i& dimensions, SharedPtr<TextureResource>& page, Vector2f texcoords[2]);
+	/// Frees the space of an image packed by Add(). Does nothing if the page is not part of this atlas.
+	/// @param[in] page The texture resource of the page the image was placed on.
+	/// @param[in] texcoords The texture coordinates of the image within the page, as returned by Add().
+	/// @param[in] dimensions The dimensions of the image.
+	void Remove(const TextureResource* page, const Vector2f texcoords[2], const Vector2i& dimensions);
+
+	/// Releases the textures of pages which have had images added since their texture was generated, so that they are
+	/// regenerated on next use. Should be called at a point where no page handles are in use by the render interface.
+	void Update();
+
+private:
+	struct PageData;
+	struct Page {
+		RenderInterface* render_interface;
+		SharedPtr<TextureResource> resource;
+		SharedPtr<PageData> data;
+	};
+
+	Page CreatePage(RenderInterface* render_interface);
+
+	int max_image_dimensions;
+	int page_dimensions;
+
+	std::vector<Page> pages;
+};
+
+}
+}
+
+#endif
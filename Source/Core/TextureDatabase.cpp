@@ -27,10 +27,12 @@
  */
 
 #include "TextureDatabase.h"
+#include "TextureAtlas.h"
 #include "TextureResource.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include <algorithm>
 
 namespace Rml {
 namespace Core {
@@ -69,6 +71,8 @@ SharedPtr<TextureResource> TextureDatabase::Fetch(const String& source, const St
 	else
 		GetSystemInterface()->JoinPath(path, StringUtilities::Replace(source_directory, '|', ':'), source);
 
+	std::lock_guard<std::mutex> lock(texture_database->textures_mutex);
+
 	TextureMap::iterator iterator = texture_database->textures.find(path);
 	if (iterator != texture_database->textures.end())
 	{
@@ -94,12 +98,128 @@ void TextureDatabase::RemoveCallbackTexture(TextureResource* texture)
 		texture_database->callback_textures.erase(texture);
 }
 
-void TextureDatabase::ReleaseTextures(RenderInterface* render_interface)
+void TextureDatabase::SetMemoryBudget(size_t budget)
+{
+	if (texture_database)
+	{
+		texture_database->statistics.memory_budget = budget;
+		texture_database->EnforceMemoryBudget();
+	}
+}
+
+TextureMemoryStatistics TextureDatabase::GetMemoryStatistics()
+{
+	if (texture_database)
+		return texture_database->statistics;
+
+	return TextureMemoryStatistics();
+}
+
+void TextureDatabase::SetTextureAtlas(int max_image_dimensions, int page_dimensions)
+{
+	if (texture_database)
+	{
+		if (max_image_dimensions > 0)
+			texture_database->texture_atlas = std::make_unique<TextureAtlas>(max_image_dimensions, page_dimensions);
+		else
+			texture_database->texture_atlas.reset();
+	}
+}
+
+TextureAtlas* TextureDatabase::GetTextureAtlas()
+{
+	if (texture_database)
+		return texture_database->texture_atlas.get();
+
+	return nullptr;
+}
+
+void TextureDatabase::UpdateTextureAtlas()
+{
+	if (texture_database && texture_database->texture_atlas)
+		texture_database->texture_atlas->Update();
+}
+
+uint64_t TextureDatabase::GetUseTick()
+{
+	if (texture_database)
+		return ++texture_database->use_tick;
+
+	return 0;
+}
+
+unsigned int TextureDatabase::GetReleaseGeneration()
+{
+	if (texture_database)
+		return texture_database->release_generation;
+
+	return 0;
+}
+
+void TextureDatabase::OnTextureLoaded(size_t size, bool reload)
+{
+	if (texture_database)
+	{
+		texture_database->statistics.memory_usage += size;
+		if (reload)
+			texture_database->statistics.num_reloads += 1;
+
+		texture_database->EnforceMemoryBudget();
+	}
+}
+
+void TextureDatabase::OnTextureReleased(size_t size)
+{
+	if (texture_database)
+	{
+		RMLUI_ASSERT(texture_database->statistics.memory_usage >= size);
+		texture_database->statistics.memory_usage -= size;
+		texture_database->release_generation += 1;
+	}
+}
+
+void TextureDatabase::EnforceMemoryBudget()
+{
+	if (statistics.memory_budget == 0 || statistics.memory_usage <= statistics.memory_budget || enforcing_budget)
+		return;
+
+	enforcing_budget = true;
+
+	// Only textures that are not referenced outside the database can be released, any geometry using a texture holds a
+	// reference to it. Released textures stay in the database and are transparently reloaded when used again.
+	std::vector<TextureResource*> candidates;
+	{
+		std::lock_guard<std::mutex> lock(textures_mutex);
+		for (const auto& texture : textures)
+		{
+			if (texture.second.use_count() == 1 && texture.second->GetMemoryUsage() > 0)
+				candidates.push_back(texture.second.get());
+		}
+	}
+
+	std::sort(candidates.begin(), candidates.end(), [](const TextureResource* a, const TextureResource* b) {
+		return a->GetLastUseTick() < b->GetLastUseTick();
+	});
+
+	for (TextureResource* texture : candidates)
+	{
+		if (statistics.memory_usage <= statistics.memory_budget)
+			break;
+
+		texture->Evict();
+		statistics.num_evictions += 1;
+	}
+
+	enforcing_budget = false;
+}
+
+void TextureDatabase::ReleaseTextures(RenderInterface* render_interface, bool free_atlas_space)
 {
 	if (texture_database)
 	{
+		std::lock_guard<std::mutex> lock(texture_database->textures_mutex);
 		for (const auto& texture : texture_database->textures)
-			texture.second->Release(render_interface);
+			texture.second->Release(render_interface, free_atlas_space);
 
 		for (const auto& texture : texture_database->callback_textures)
 			texture->Release(render_interface);
@@ -30,11 +30,14 @@
 #define RMLUICORETEXTUREDATABASE_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+#include <mutex>
 
 namespace Rml {
 namespace Core {
 
 class RenderInterface;
+class TextureAtlas;
 class TextureResource;
 
 /**
@@ -54,7 +57,9 @@ public:
 
 	/// Release all textures bound through a render interface.
     /// Pass nullptr to release all textures in the database.
-	static void ReleaseTextures(RenderInterface* render_interface = nullptr);
+	/// Images packed into the texture atlas keep their place unless the atlas space is to be freed as well, as when the
+	/// render interface is destroyed.
+	static void ReleaseTextures(RenderInterface* render_interface = nullptr, bool free_atlas_space = false);
 
     /// Adds a texture resource with a callback function and stores it as a weak (raw) pointer in the database.
     static void AddCallbackTexture(TextureResource* texture);
@@ -62,15 +67,52 @@ public:
     /// Removes a callback texture from the database.
     static void RemoveCallbackTexture(TextureResource* texture);
 
+	/// Sets the texture memory budget in bytes, or zero to disable the budget.
+	/// If the budget is exceeded, unused textures are released in least-recently-used order.
+	static void SetMemoryBudget(size_t budget);
+	/// Returns the current texture memory statistics.
+	static TextureMemoryStatistics GetMemoryStatistics();
+
+	/// Enables packing of small textures into a runtime texture atlas, or disables it if the maximum image dimensions is zero.
+	/// Only affects textures loaded after the call.
+	static void SetTextureAtlas(int max_image_dimensions, int page_dimensions);
+	/// Returns the texture atlas, or nullptr if texture atlasing is disabled.
+	static TextureAtlas* GetTextureAtlas();
+	/// Regenerates atlas pages which have been modified since they were last used. Called when updating a context, so
+	/// that page textures are not released while the render interface may still be using them.
+	static void UpdateTextureAtlas();
+
+	/// Returns a new tick to mark the last use of a texture resource.
+	static uint64_t GetUseTick();
+	/// Returns a counter which is incremented whenever texture data is released. Texture handles can only change after
+	/// a release, so users of a handle only need to check it again when the counter changes.
+	static unsigned int GetReleaseGeneration();
+
+	/// Called by texture resources when texture data has been loaded or released, for keeping track of memory usage.
+	static void OnTextureLoaded(size_t size, bool reload);
+	static void OnTextureReleased(size_t size);
+
 private:
+	/// Releases unused textures in least-recently-used order until the memory usage is within the budget.
+	void EnforceMemoryBudget();
+
 	TextureDatabase();
 	~TextureDatabase();
 
 	using TextureMap = UnorderedMap< String, SharedPtr<TextureResource> >;
 	TextureMap textures;
+	// Guards the texture map, as textures may be fetched by style sheets parsed in the document loader thread.
+	std::mutex textures_mutex;
 
     using CallbackTextureMap = UnorderedSet< TextureResource* >;
     CallbackTextureMap callback_textures;
+
+	UniquePtr<TextureAtlas> texture_atlas;
+
+	uint64_t use_tick = 0;
+	unsigned int release_generation = 0;
+	bool enforcing_budget = false;
+	TextureMemoryStatistics statistics;
 };
 
 }
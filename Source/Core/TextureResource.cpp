@@ -27,6 +27,7 @@
  */
 
 #include "TextureResource.h"
+#include "TextureAtlas.h"
 #include "TextureDatabase.h"
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
@@ -35,6 +36,20 @@
 namespace Rml {
 namespace Core {
 
+static size_t GetTextureDataSize(const Vector2i& dimensions)
+{
+	return size_t(dimensions.x) * size_t(dimensions.y) * 4;
+}
+
+static size_t GetTextureDataSize(const TextureResource::TextureData& data)
+{
+	// Memory of textures packed into an atlas is accounted for by the atlas page.
+	if (data.atlas_page)
+		return 0;
+
+	return GetTextureDataSize(data.dimensions);
+}
+
 TextureResource::TextureResource()
 {
 }
@@ -60,7 +75,7 @@ void TextureResource::Set(const String& name, const TextureCallback& callback)
 
 void TextureResource::Reset()
 {
-	Release();
+	Release(nullptr, true);
 
 	if (texture_callback)
 	{
@@ -74,27 +89,29 @@ void TextureResource::Reset()
 // Returns the resource's underlying texture.
 TextureHandle TextureResource::GetHandle(RenderInterface* render_interface)
 {
-	auto texture_iterator = texture_data.find(render_interface);
-	if (texture_iterator == texture_data.end())
-	{
-		Load(render_interface);
-		texture_iterator = texture_data.find(render_interface);
-	}
+	last_use_tick = TextureDatabase::GetUseTick();
 
-	return texture_iterator->second.first;
+	const TextureData& data = GetTextureData(render_interface);
+	if (data.atlas_page)
+		return data.atlas_page->GetHandle(render_interface);
+
+	return data.handle;
 }
 
 // Returns the dimensions of the resource's texture.
 const Vector2i& TextureResource::GetDimensions(RenderInterface* render_interface)
 {
-	auto texture_iterator = texture_data.find(render_interface);
-	if (texture_iterator == texture_data.end())
-	{
-		Load(render_interface);
-		texture_iterator = texture_data.find(render_interface);
-	}
+	return GetTextureData(render_interface).dimensions;
+}
+
+// Maps normalized texture coordinates to the coordinates of the resource's underlying texture.
+Vector2f TextureResource::MapTexCoord(RenderInterface* render_interface, const Vector2f& texcoord)
+{
+	const TextureData& data = GetTextureData(render_interface);
+	if (!data.atlas_page)
+		return texcoord;
 
-	return texture_iterator->second.second;
+	return data.atlas_texcoords[0] + texcoord * (data.atlas_texcoords[1] - data.atlas_texcoords[0]);
 }
 
 // Returns the resource's source.
@@ -104,31 +121,67 @@ const String& TextureResource::GetSource() const
 }
 
 // Releases the texture's handle.
-void TextureResource::Release(RenderInterface* render_interface)
+void TextureResource::Release(RenderInterface* render_interface, bool free_atlas_space)
 {
-	if (!render_interface)
+	for (auto it = texture_data.begin(); it != texture_data.end();)
 	{
-		for (auto& interface_data_pair : texture_data)
+		TextureData& data = it->second;
+		if (render_interface && it->first != render_interface)
 		{
-			TextureHandle handle = interface_data_pair.second.first;
-			if (handle)
-				interface_data_pair.first->ReleaseTexture(handle);
+			++it;
+			continue;
+		}
+
+		if (data.atlas_page)
+		{
+			// The atlas page holds the image, its own texture is released and regenerated when used again.
+			if (!free_atlas_space)
+			{
+				++it;
+				continue;
+			}
+
+			if (TextureAtlas* texture_atlas = TextureDatabase::GetTextureAtlas())
+				texture_atlas->Remove(data.atlas_page.get(), data.atlas_texcoords, data.dimensions);
 		}
+		else if (data.handle)
+			it->first->ReleaseTexture(data.handle);
 
-		texture_data.clear();
+		TextureDatabase::OnTextureReleased(GetTextureDataSize(data));
+
+		it = texture_data.erase(it);
 	}
-	else
-	{
-		TextureDataMap::iterator texture_iterator = texture_data.find(render_interface);
-		if (texture_iterator == texture_data.end())
-			return;
+}
+
+void TextureResource::Evict()
+{
+	Release();
+	evicted = true;
+}
 
-		TextureHandle handle = texture_iterator->second.first;
-		if (handle)
-			texture_iterator->first->ReleaseTexture(handle);
+size_t TextureResource::GetMemoryUsage() const
+{
+	size_t result = 0;
+	for (auto& interface_data_pair : texture_data)
+		result += GetTextureDataSize(interface_data_pair.second);
+	return result;
+}
 
-		texture_data.erase(render_interface);
+uint64_t TextureResource::GetLastUseTick() const
+{
+	return last_use_tick;
+}
+
+TextureResource::TextureData& TextureResource::GetTextureData(RenderInterface* render_interface)
+{
+	auto texture_iterator = texture_data.find(render_interface);
+	if (texture_iterator == texture_data.end())
+	{
+		Load(render_interface);
+		texture_iterator = texture_data.find(render_interface);
 	}
+
+	return texture_iterator->second;
 }
 
 bool TextureResource::Load(RenderInterface* render_interface)
@@ -146,7 +199,7 @@ bool TextureResource::Load(RenderInterface* render_interface)
 		if (!callback_fnc(source, data, dimensions) || !data)
 		{
 			Log::Message(Log::LT_WARNING, "Failed to generate texture from callback function %s.", source.c_str());
-			texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+			texture_data[render_interface] = TextureData();
 
 			return false;
 		}
@@ -157,30 +210,55 @@ bool TextureResource::Load(RenderInterface* render_interface)
 		if (success)
 		{
 			texture_data[render_interface] = TextureData(handle, dimensions);
+			OnLoaded(dimensions);
 		}
 		else
 		{
 			Log::Message(Log::LT_WARNING, "Failed to generate internal texture %s.", source.c_str());
-			texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+			texture_data[render_interface] = TextureData();
 		}
 
 		return success;
 	}
 
-	// No callback function, load the texture through the render interface.
+	// No callback function, try to pack the texture into the texture atlas if enabled.
+	if (TextureAtlas* texture_atlas = TextureDatabase::GetTextureAtlas())
+	{
+		UniquePtr<const byte[]> data;
+		Vector2i dimensions;
+		if (render_interface->LoadTextureData(data, dimensions, source) && data)
+		{
+			TextureData atlas_data;
+			atlas_data.dimensions = dimensions;
+			if (texture_atlas->Add(render_interface, data.get(), dimensions, atlas_data.atlas_page, atlas_data.atlas_texcoords))
+			{
+				texture_data[render_interface] = std::move(atlas_data);
+				return true;
+			}
+		}
+	}
+
+	// Otherwise, load the texture through the render interface.
 	TextureHandle handle;
 	Vector2i dimensions;
 	if (!render_interface->LoadTexture(handle, dimensions, source))
 	{
 		Log::Message(Log::LT_WARNING, "Failed to load texture from %s.", source.c_str());
-		texture_data[render_interface] = TextureData(0, Vector2i(0, 0));
+		texture_data[render_interface] = TextureData();
 
 		return false;
 	}
 
 	texture_data[render_interface] = TextureData(handle, dimensions);
+	OnLoaded(dimensions);
 	return true;
 }
 
+void TextureResource::OnLoaded(const Vector2i& dimensions)
+{
+	TextureDatabase::OnTextureLoaded(GetTextureDataSize(dimensions), evicted);
+	evicted = false;
+}
+
 }
 }
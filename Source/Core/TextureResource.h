@@ -60,26 +60,59 @@ public:
 	TextureHandle GetHandle(RenderInterface* render_interface);
 	/// Returns the dimensions of the resource's texture.
 	const Vector2i& GetDimensions(RenderInterface* render_interface);
+	/// Maps normalized texture coordinates to the coordinates of the resource's underlying texture.
+	Vector2f MapTexCoord(RenderInterface* render_interface, const Vector2f& texcoord);
 
 	/// Returns the resource's source.
 	const String& GetSource() const;
 
-	/// Releases the texture's handle.
-	void Release(RenderInterface* render_interface = nullptr);
+	/// Releases the texture's handle. Images packed into the texture atlas keep their place, since geometry refers to
+	/// it by texture coordinates, unless the atlas space is to be freed as well.
+	/// @param[in] render_interface The render interface to release the texture of, or nullptr for all.
+	/// @param[in] free_atlas_space True to also remove the texture from the texture atlas.
+	void Release(RenderInterface* render_interface = nullptr, bool free_atlas_space = false);
+
+	/// Releases the texture's handles to reduce memory usage. The texture is reloaded on next use.
+	void Evict();
+
+	/// Returns the estimated number of bytes used by the texture data of all render interfaces.
+	size_t GetMemoryUsage() const;
+	/// Returns the tick of the last time the texture's handle was requested.
+	uint64_t GetLastUseTick() const;
+
+	struct TextureData {
+		TextureData() = default;
+		TextureData(TextureHandle handle, const Vector2i& dimensions) : handle(handle), dimensions(dimensions) {}
+
+		TextureHandle handle = 0;
+		Vector2i dimensions;
+
+		// Set if the texture is packed into a texture atlas, then the handle is owned by the atlas page.
+		SharedPtr<TextureResource> atlas_page;
+		Vector2f atlas_texcoords[2];
+	};
 
 private:
 	void Reset();
 
+	/// Returns the texture data for the given render interface, loading it first if necessary.
+	TextureData& GetTextureData(RenderInterface* render_interface);
+
 	/// Attempts to load the texture from the source, or the callback function if set.
 	bool Load(RenderInterface* render_interface);
 
+	/// Updates the memory usage statistics after loading texture data.
+	void OnLoaded(const Vector2i& dimensions);
+
 	String source;
 
-	using TextureData = std::pair< TextureHandle, Vector2i >;
 	using TextureDataMap = SmallUnorderedMap< RenderInterface*, TextureData >;
 	TextureDataMap texture_data;
 
 	UniquePtr<TextureCallback> texture_callback;
+
+	uint64_t last_use_tick = 0;
+	bool evicted = false;
 };
 
 }
@@ -0,0 +1,140 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "XMLNodeTree.h"
+#include "../../Include/RmlUi/Core/BaseXMLParser.h"
+#include "../../Include/RmlUi/Core/Profiling.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+
+namespace Rml {
+namespace Core {
+
+// Records the parser events into the nodes of a tree.
+class XMLNodeTree::NodeRecorder : public BaseXMLParser
+{
+public:
+	NodeRecorder(XMLNodeTree& tree) : tree(tree)
+	{
+		// Should match the CDATA tags registered by the XMLParser.
+		RegisterCDATATag("script");
+	}
+
+	void HandleElementStart(const String& name, const XMLAttributes& element_attributes) override
+	{
+		int attributes_index = -1;
+		if (!element_attributes.empty())
+		{
+			attributes_index = (int)tree.attributes.size();
+			tree.attributes.push_back(element_attributes);
+		}
+
+		AddNode(NodeType::ElementStart, attributes_index, name);
+	}
+
+	void HandleElementEnd(const String& name) override
+	{
+		AddNode(NodeType::ElementEnd, -1, name);
+	}
+
+	void HandleData(const String& data) override
+	{
+		AddNode(NodeType::Data, -1, data);
+	}
+
+private:
+	void AddNode(NodeType type, int attributes_index, const String& value)
+	{
+		tree.nodes.push_back(Node{ type, attributes_index, GetLineNumber(), GetLineNumberOpenTag(), value });
+	}
+
+	XMLNodeTree& tree;
+};
+
+XMLNodeTree::XMLNodeTree()
+{
+}
+
+XMLNodeTree::~XMLNodeTree()
+{
+}
+
+void XMLNodeTree::Load(Stream* stream)
+{
+	RMLUI_ZoneScoped;
+
+	source_url = stream->GetSourceURL();
+	nodes.clear();
+	attributes.clear();
+
+	NodeRecorder recorder(*this);
+	recorder.Parse(stream);
+
+	nodes.shrink_to_fit();
+	attributes.shrink_to_fit();
+}
+
+void XMLNodeTree::Parse(BaseXMLParser& parser) const
+{
+	RMLUI_ZoneScoped;
+
+	// Handlers may query the source URL through the parser, so give it an empty stream carrying the original URL.
+	StreamMemory source_stream;
+	source_stream.SetSourceURL(source_url);
+	parser.xml_source = &source_stream;
+
+	const XMLAttributes empty_attributes;
+
+	for (const Node& node : nodes)
+	{
+		parser.line_number = node.line_number;
+		parser.line_number_open_tag = node.line_number_open_tag;
+
+		switch (node.type)
+		{
+		case NodeType::ElementStart:
+			parser.HandleElementStart(node.value, node.attributes_index < 0 ? empty_attributes : attributes[node.attributes_index]);
+			break;
+		case NodeType::ElementEnd:
+			parser.HandleElementEnd(node.value);
+			break;
+		case NodeType::Data:
+			parser.HandleData(node.value);
+			break;
+		}
+	}
+
+	parser.xml_source = nullptr;
+}
+
+const URL& XMLNodeTree::GetSourceURL() const
+{
+	return source_url;
+}
+
+}
+}
@@ -0,0 +1,86 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUICOREXMLNODETREE_H
+#define RMLUICOREXMLNODETREE_H
+
+#include "../../Include/RmlUi/Core/Types.h"
+#include "../../Include/RmlUi/Core/URL.h"
+
+namespace Rml {
+namespace Core {
+
+class BaseXMLParser;
+class Stream;
+
+/**
+	An immutable, pre-parsed form of an XML stream. The tree stores the sequence of element and data nodes reported
+	by the parser, so that the stream can later be replayed into any parser without reading and tokenizing it again.
+ */
+
+class XMLNodeTree
+{
+public:
+	XMLNodeTree();
+	~XMLNodeTree();
+
+	/// Reads and tokenizes the given stream into the node tree.
+	/// @param[in] stream The stream to read the XML from.
+	void Load(Stream* stream);
+
+	/// Replays the stored nodes into the given parser, calling its handlers as if it was parsing the original stream.
+	/// @param[in] parser The parser to call the handlers on.
+	void Parse(BaseXMLParser& parser) const;
+
+	/// Returns the URL of the stream the nodes were read from.
+	const URL& GetSourceURL() const;
+
+private:
+	enum class NodeType : byte { ElementStart, ElementEnd, Data };
+
+	struct Node {
+		NodeType type;
+		// The index into 'attributes' for element start nodes with attributes, otherwise -1.
+		int attributes_index;
+		int line_number;
+		int line_number_open_tag;
+		// The tag name for element nodes, or the character data for data nodes.
+		String value;
+	};
+
+	class NodeRecorder;
+
+	URL source_url;
+	std::vector<Node> nodes;
+	std::vector<XMLAttributes> attributes;
+};
+
+}
+}
+
+#endif
@@ -81,6 +81,15 @@ XMLNodeHandler* XMLParser::RegisterNodeHandler(const String& _tag, SharedPtr<XML
 	return result;
 }
 
+XMLNodeHandler* XMLParser::GetNodeHandler(const String& tag)
+{
+	NodeHandlers::iterator i = node_handlers.find(StringUtilities::ToLower(tag));
+	if (i == node_handlers.end())
+		return nullptr;
+
+	return i->second.get();
+}
+
 // Releases all registered node handlers. This is called internally.
 void XMLParser::ReleaseHandlers()
 {
@@ -0,0 +1,184 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TestsShell.h"
+#include <RmlUi/Controls.h>
+#include <RmlUi/Controls/DataSource.h>
+
+using namespace Rml::Core;
+
+class PlayerDataSource : public Rml::Controls::DataSource
+{
+public:
+	PlayerDataSource() : DataSource("players") {}
+
+	void GetRow(StringList& row, const String& /*table*/, int row_index, const StringList& columns) override
+	{
+		for (const String& column : columns)
+			row.push_back(column == "name" ? CreateString(32, "Player %d", row_index) : CreateString(32, "%d", row_index * 10));
+	}
+
+	int GetNumRows(const String& /*table*/) override
+	{
+		return 20;
+	}
+};
+
+static const String document_header = R"(<rml><head><style>
+body { display: block; width: 600px; font-family: Delicious; font-size: 16px; }
+p { display: block; }
+virtuallist { display: block; height: 200px; overflow-y: auto; }
+listrow { display: block; height: 20px; }
+</style></head>)";
+
+static String GetText(Element* element)
+{
+	if (ElementText* text = rmlui_dynamic_cast< ElementText* >(element->GetFirstChild()))
+		return text->GetText();
+	return String();
+}
+
+static void TestBindings(Context* context)
+{
+	DataModel* model = context->CreateDataModel("stats");
+	TEST_CHECK(model != nullptr);
+	TEST_CHECK(context->CreateDataModel("stats") == nullptr);
+
+	int health = 10;
+	String name = "Bob";
+	TEST_CHECK(model->Bind("health", &health));
+	TEST_CHECK(model->Bind("name", &name));
+	TEST_CHECK(!model->Bind("health", &health));
+
+	ElementDocument* document = TestsShell::LoadDocument(context, document_header + R"(<body data-model="stats">
+<p id="text">Health: {{ health }} of {{name}}</p>
+<p id="attributes" data-attr-title="name" data-attr-class="level{{health}}">plain</p>
+<p id="unbound">{{ unknown }}</p>
+<p id="outside">{{name}}</p>
+</body></rml>)");
+	if (!document)
+		return;
+
+	TEST_CHECK(GetText(document->GetElementById("text")) == "Health: 10 of Bob");
+	TEST_CHECK(document->GetElementById("attributes")->GetAttribute< String >("title", "") == "Bob");
+	TEST_CHECK(document->GetElementById("attributes")->IsClassSet("level10"));
+	TEST_CHECK(GetText(document->GetElementById("unbound")) == "");
+
+	// Only bindings of variables marked dirty are evaluated again.
+	health = 5;
+	model->DirtyVariable("health");
+	TEST_CHECK(model->IsVariableDirty("health"));
+	context->Update();
+	TEST_CHECK(!model->IsVariableDirty("health"));
+	TEST_CHECK(GetText(document->GetElementById("text")) == "Health: 5 of Bob");
+	TEST_CHECK(document->GetElementById("attributes")->IsClassSet("level5"));
+	TEST_CHECK(!document->GetElementById("attributes")->IsClassSet("level10"));
+
+	name = "Alice";
+	context->Update();
+	TEST_CHECK(document->GetElementById("attributes")->GetAttribute< String >("title", "") == "Bob");
+
+	model->DirtyVariable("name");
+	context->Update();
+	TEST_CHECK(GetText(document->GetElementById("text")) == "Health: 5 of Alice");
+	TEST_CHECK(document->GetElementById("attributes")->GetAttribute< String >("title", "") == "Alice");
+
+	// Content instanced later from RML is bound as well, also when patched.
+	Element* outside = document->GetElementById("outside");
+	outside->SetInnerRML("<span id='dynamic'>{{health}}!</span>");
+	TEST_CHECK(GetText(document->GetElementById("dynamic")) == "5!");
+	outside->PatchInnerRML("<b>{{health}}</b>");
+	health = 7;
+	model->DirtyVariable("health");
+	context->Update();
+	TEST_CHECK(outside->GetInnerRML() == "<b>7</b>");
+
+	// Bound elements may be destroyed while the model lives on.
+	outside->SetInnerRML("");
+	model->DirtyAllVariables();
+	context->Update();
+
+	document->Close();
+	context->Update();
+
+	TEST_CHECK(context->RemoveDataModel("stats"));
+	TEST_CHECK(context->GetDataModel("stats") == nullptr);
+}
+
+static void TestVirtualListTemplate(Context* context)
+{
+	PlayerDataSource data_source;
+
+	DataModel* model = context->CreateDataModel("list_model");
+	String name = "Model name";
+	model->Bind("name", &name);
+
+	// The virtual list fills in its template with the same syntax, so its contents must never be bound to the model.
+	ElementDocument* document = TestsShell::LoadDocument(context, document_header + R"(<body data-model="list_model">
+<virtuallist id="list" source="players.scores" fields="name,score"><span>{{name}}</span>: {{score}}</virtuallist>
+<p id="bound">{{name}}</p>
+</body></rml>)");
+	if (!document)
+		return;
+
+	context->Update();
+
+	Rml::Controls::ElementVirtualList* list = rmlui_dynamic_cast< Rml::Controls::ElementVirtualList* >(document->GetElementById("list"));
+	TEST_CHECK(list != nullptr);
+	TEST_CHECK(GetText(document->GetElementById("bound")) == "Model name");
+
+	if (list)
+	{
+		TEST_CHECK(list->GetRow(3) != nullptr);
+		if (Element* row = list->GetRow(3))
+			TEST_CHECK(row->GetInnerRML() == "<span>Player 3</span>: 30");
+	}
+
+	name = "Changed";
+	model->DirtyVariable("name");
+	context->Update();
+	TEST_CHECK(GetText(document->GetElementById("bound")) == "Changed");
+	if (list && list->GetRow(3))
+		TEST_CHECK(list->GetRow(3)->GetInnerRML() == "<span>Player 3</span>: 30");
+
+	document->Close();
+	context->Update();
+	context->RemoveDataModel("list_model");
+}
+
+int main()
+{
+	Context* context = TestsShell::Initialise();
+
+	TestBindings(context);
+	TestVirtualListTemplate(context);
+
+	TestsShell::Shutdown();
+
+	return TestsShell::Finish("DataModel");
+}
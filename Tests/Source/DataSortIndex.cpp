@@ -0,0 +1,231 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TestsShell.h"
+#include <RmlUi/Controls/DataSource.h>
+#include <algorithm>
+#include <cmath>
+#include <stdlib.h>
+
+using namespace Rml::Core;
+using namespace Rml::Controls;
+
+// A table of rows with a name, an integer score and a floating-point weight, which exposes its notifications.
+class TestDataSource : public DataSource
+{
+public:
+	struct Row
+	{
+		String name;
+		String score;
+		String weight;
+	};
+
+	TestDataSource() : DataSource("sort_test") {}
+
+	void GetRow(StringList& row, const String& /*table*/, int row_index, const StringList& columns) override
+	{
+		for (const String& column : columns)
+		{
+			const Row& source_row = rows[row_index];
+			if (column == "name")
+				row.push_back(source_row.name);
+			else if (column == "score")
+				row.push_back(source_row.score);
+			else if (column == "weight")
+				row.push_back(source_row.weight);
+			else
+				row.push_back(String());
+		}
+	}
+
+	int GetNumRows(const String& /*table*/) override
+	{
+		return (int)rows.size();
+	}
+
+	void Add(int index, const std::vector< Row >& new_rows)
+	{
+		rows.insert(rows.begin() + index, new_rows.begin(), new_rows.end());
+		NotifyRowAdd("rows", index, (int)new_rows.size());
+	}
+
+	void Remove(int index, int count)
+	{
+		rows.erase(rows.begin() + index, rows.begin() + index + count);
+		NotifyRowRemove("rows", index, count);
+	}
+
+	void Change(int index, const Row& row)
+	{
+		rows[index] = row;
+		NotifyRowChange("rows", index, 1);
+	}
+
+	std::vector< Row > rows;
+};
+
+// The ordering expected by score, then by descending weight with NaN greater than all numbers, and ties in table order.
+static std::vector< int > ReferenceOrder(const std::vector< TestDataSource::Row >& rows)
+{
+	std::vector< int > order(rows.size());
+	for (size_t i = 0; i < order.size(); i++)
+		order[i] = (int)i;
+
+	std::sort(order.begin(), order.end(), [&rows](int left, int right) {
+		const long long left_score = atoll(rows[left].score.c_str());
+		const long long right_score = atoll(rows[right].score.c_str());
+		if (left_score != right_score)
+			return left_score < right_score;
+
+		const float left_weight = (float)atof(rows[left].weight.c_str());
+		const float right_weight = (float)atof(rows[right].weight.c_str());
+		const bool left_nan = std::isnan(left_weight), right_nan = std::isnan(right_weight);
+		if (left_nan != right_nan)
+			return left_nan;
+		if (!left_nan && left_weight != right_weight)
+			return left_weight > right_weight;
+
+		return left < right;
+	});
+
+	return order;
+}
+
+static TestDataSource::Row RandomRow()
+{
+	const char* weights[] = { "0.5", "1.25", "-3", "nan", "NaN", "2", "0" };
+	TestDataSource::Row row;
+	row.name = CreateString(32, "row%d", rand() % 100);
+	row.score = CreateString(32, "%d", rand() % 10 - 5);
+	row.weight = weights[rand() % 7];
+	return row;
+}
+
+static void TestNaNOrder()
+{
+	TestDataSource data_source;
+	const char* weights[] = { "3", "nan", "1", "NaN", "-2", "2.5", "nan", "0" };
+	for (const char* weight : weights)
+		data_source.rows.push_back(TestDataSource::Row{ "", "0", weight });
+
+	// Without a strict weak ordering, NaN values would scramble the numbers around them. They compare greater than all
+	// numbers and equal to each other, so they keep their table order.
+	const std::vector< int >& sorted_rows = data_source.GetSortedRows("rows", "weight");
+	const std::vector< int > expected_rows = { 4, 7, 2, 5, 0, 1, 3, 6 };
+	TEST_CHECK(sorted_rows == expected_rows);
+
+	const std::vector< int >& descending_rows = data_source.GetSortedRows("rows", "weight desc");
+	const std::vector< int > expected_descending_rows = { 1, 3, 6, 0, 5, 2, 7, 4 };
+	TEST_CHECK(descending_rows == expected_descending_rows);
+}
+
+static void TestIntegerRange()
+{
+	TestDataSource data_source;
+	const char* scores[] = { "3000000000", "1", "-5", "2", "-3000000000" };
+	for (const char* score : scores)
+		data_source.rows.push_back(TestDataSource::Row{ "", score, "0" });
+
+	// Values outside the range of an int must not wrap around, they are sorted as floating-point numbers instead.
+	const std::vector< int >& sorted_rows = data_source.GetSortedRows("rows", "score");
+	const std::vector< int > expected_rows = { 4, 2, 1, 3, 0 };
+	TEST_CHECK(sorted_rows == expected_rows);
+
+	std::vector< int > values;
+	TEST_CHECK(!data_source.GetColumnValues(values, "rows", "score", 0, 5));
+	TEST_CHECK(data_source.GetColumnValues(values, "rows", "score", 1, 3));
+	TEST_CHECK(values == std::vector< int >({ 1, -5, 2 }));
+}
+
+static void TestStringOrder()
+{
+	TestDataSource data_source;
+	const char* names[] = { "delta", "alpha", "charlie", "bravo", "alpha" };
+	for (const char* name : names)
+		data_source.rows.push_back(TestDataSource::Row{ name, "0", "0" });
+
+	const std::vector< int >& sorted_rows = data_source.GetSortedRows("rows", "name");
+	TEST_CHECK(sorted_rows == std::vector< int >({ 1, 4, 3, 2, 0 }));
+}
+
+static void TestIncrementalUpdates()
+{
+	srand(26);
+
+	TestDataSource data_source;
+	for (int i = 0; i < 50; i++)
+		data_source.rows.push_back(RandomRow());
+
+	const String order = "score, weight desc";
+	TEST_CHECK(data_source.GetSortedRows("rows", order) == ReferenceOrder(data_source.rows));
+
+	// The cached ordering is updated with each notification, and must always match a full sort of the table.
+	for (int step = 0; step < 200; step++)
+	{
+		const int num_rows = (int)data_source.rows.size();
+		const int operation = rand() % 3;
+
+		if (operation == 0 || num_rows < 10)
+		{
+			std::vector< TestDataSource::Row > new_rows(rand() % 5 + 1);
+			for (TestDataSource::Row& row : new_rows)
+				row = RandomRow();
+			data_source.Add(rand() % (num_rows + 1), new_rows);
+		}
+		else if (operation == 1)
+		{
+			const int count = rand() % 3 + 1;
+			data_source.Remove(rand() % (num_rows - count), count);
+		}
+		else
+		{
+			data_source.Change(rand() % num_rows, RandomRow());
+		}
+
+		if (data_source.GetSortedRows("rows", order) != ReferenceOrder(data_source.rows))
+		{
+			TEST_CHECK(data_source.GetSortedRows("rows", order) == ReferenceOrder(data_source.rows));
+			break;
+		}
+	}
+}
+
+int main()
+{
+	TestsShell::Initialise();
+
+	TestNaNOrder();
+	TestIntegerRange();
+	TestStringOrder();
+	TestIncrementalUpdates();
+
+	TestsShell::Shutdown();
+
+	return TestsShell::Finish("DataSortIndex");
+}
@@ -0,0 +1,221 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TestsShell.h"
+#include <RmlUi/Controls.h>
+#include <functional>
+
+using namespace Rml::Core;
+
+// Records the notifications of children added to and removed from the element itself.
+class ElementNotified : public Element
+{
+public:
+	ElementNotified(const String& tag) : Element(tag) {}
+
+	ElementList added;
+	ElementList removed;
+	// Called for each child added, before it is recorded.
+	std::function< void(Element*) > on_add;
+
+protected:
+	void OnChildAdd(Element* child) override
+	{
+		if (child->GetParentNode() != this)
+			return;
+
+		if (on_add)
+			on_add(child);
+		added.push_back(child);
+	}
+
+	void OnChildRemove(Element* child) override
+	{
+		if (child->GetParentNode() == this)
+			removed.push_back(child);
+	}
+};
+
+static const String document_rml = R"(<rml><head><style>
+body { display: block; width: 600px; font-family: Delicious; font-size: 16px; }
+notified, div, p { display: block; }
+</style></head><body><notified id="list"/><form id="form"/></body></rml>)";
+
+static void TestDeferredNotifications(ElementDocument* document)
+{
+	ElementNotified* list = static_cast< ElementNotified* >(document->GetElementById("list"));
+	list->added.clear();
+	list->removed.clear();
+
+	list->BeginBatch();
+	list->BeginBatch();
+	Element* a = list->AppendChild(document->CreateElement("div"));
+	Element* b = list->AppendChild(document->CreateElement("div"));
+	Element* c = list->InsertBefore(document->CreateElement("div"), a);
+	list->EndBatch();
+
+	// Nothing is announced until the outermost batch ends.
+	TEST_CHECK(list->added.empty());
+
+	// A child added and removed within the batch is never announced.
+	ElementPtr removed_b = list->RemoveChild(b);
+	TEST_CHECK(removed_b.get() == b);
+	TEST_CHECK(list->removed.empty());
+
+	// Children added during the batch are visible to queries straight away.
+	ElementList divs;
+	list->GetElementsByTagName(divs, "div");
+	TEST_CHECK(divs.size() == 2);
+
+	list->EndBatch();
+
+	TEST_CHECK(list->added == ElementList({ a, c }));
+	TEST_CHECK(list->removed.empty());
+	TEST_CHECK(list->GetNumChildren() == 2 && list->GetChild(0) == c && list->GetChild(1) == a);
+
+	// Outside a batch, notifications are immediate.
+	list->RemoveChild(a);
+	TEST_CHECK(list->removed == ElementList({ a }));
+
+	list->SetInnerRML("");
+}
+
+static void TestChangesDuringNotification(ElementDocument* document)
+{
+	ElementNotified* list = static_cast< ElementNotified* >(document->GetElementById("list"));
+	list->added.clear();
+	list->removed.clear();
+
+	list->BeginBatch();
+	std::vector< Element* > children;
+	for (int i = 0; i < 4; i++)
+		children.push_back(list->AppendChild(document->CreateElement("p")));
+
+	// Handlers may add and remove children while the deferred notifications are sent.
+	Element* added_by_handler = nullptr;
+	list->on_add = [&](Element* child) {
+		if (child == children[0])
+		{
+			list->RemoveChild(children[2]);
+			added_by_handler = list->AppendChild(document->CreateElement("div"));
+		}
+	};
+	list->EndBatch();
+	list->on_add = nullptr;
+
+	TEST_CHECK(added_by_handler != nullptr);
+	TEST_CHECK(list->added == ElementList({ children[0], children[1], children[3], added_by_handler }));
+	TEST_CHECK(list->removed.empty());
+
+	list->SetInnerRML("");
+}
+
+static void TestMoveBetweenBatches(ElementDocument* document)
+{
+	ElementNotified* list = static_cast< ElementNotified* >(document->GetElementById("list"));
+	Element* form = document->GetElementById("form");
+	list->added.clear();
+	list->removed.clear();
+
+	// A pending child moved to another parent is only announced by its new parent.
+	list->BeginBatch();
+	form->BeginBatch();
+	Element* moved = list->AppendChild(document->CreateElement("div"));
+	Element* kept = list->AppendChild(document->CreateElement("div"));
+	form->AppendChild(list->RemoveChild(moved));
+	list->EndBatch();
+	form->EndBatch();
+
+	TEST_CHECK(list->added == ElementList({ kept }));
+	TEST_CHECK(list->removed.empty());
+	TEST_CHECK(moved->GetParentNode() == form);
+
+	form->SetInnerRML("");
+	list->SetInnerRML("");
+}
+
+static void TestRadioButtons(Context* context, ElementDocument* document)
+{
+	// Radio buttons look up the other buttons of their form as they are added, which must see the batched children.
+	Element* form = document->GetElementById("form");
+	form->SetInnerRML(R"(<input type="radio" name="choice" id="first" checked/><input type="radio" name="choice" id="second" checked/>)");
+	context->Update();
+
+	const bool first_checked = document->GetElementById("first")->HasAttribute("checked");
+	const bool second_checked = document->GetElementById("second")->HasAttribute("checked");
+	TEST_CHECK(first_checked != second_checked);
+
+	form->SetInnerRML("");
+}
+
+static void TestLayoutDeferred(Context* context, ElementDocument* document)
+{
+	ElementNotified* list = static_cast< ElementNotified* >(document->GetElementById("list"));
+	list->SetInnerRML("");
+	context->Update();
+
+	list->BeginBatch();
+	for (int i = 0; i < 10; i++)
+	{
+		ElementPtr row = document->CreateElement("p");
+		row->SetProperty("height", "10px");
+		list->AppendChild(std::move(row));
+	}
+	list->EndBatch();
+	context->Update();
+
+	TEST_CHECK(list->GetOffsetHeight() == 100.f);
+	TEST_CHECK(list->GetChild(9)->GetOffsetTop() == 90.f);
+
+	list->SetInnerRML("");
+}
+
+int main()
+{
+	Context* context = TestsShell::Initialise();
+
+	ElementInstancerGeneric< ElementNotified > instancer;
+	Factory::RegisterElementInstancer("notified", &instancer);
+
+	ElementDocument* document = TestsShell::LoadDocument(context, document_rml);
+	if (document)
+	{
+		TestDeferredNotifications(document);
+		TestChangesDuringNotification(document);
+		TestMoveBetweenBatches(document);
+		TestRadioButtons(context, document);
+		TestLayoutDeferred(context, document);
+
+		document->Close();
+		context->Update();
+	}
+
+	TestsShell::Shutdown();
+
+	return TestsShell::Finish("ElementBatch");
+}
@@ -0,0 +1,143 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TestsShell.h"
+#include <RmlUi/Controls.h>
+#include <RmlUi/Controls/DataSource.h>
+
+using namespace Rml::Core;
+
+class CloneDataSource : public Rml::Controls::DataSource
+{
+public:
+	CloneDataSource() : DataSource("clone_source") {}
+
+	void GetRow(StringList& row, const String& /*table*/, int row_index, const StringList& columns) override
+	{
+		for (const String& column : columns)
+			row.push_back(column == "name" ? CreateString(32, "value %d", row_index) : String());
+	}
+
+	int GetNumRows(const String& /*table*/) override
+	{
+		return 3;
+	}
+};
+
+static const String document_rml = R"(<rml><head><style>
+body { display: block; width: 600px; font-family: Delicious; font-size: 16px; }
+div, p, datagrid, datagridheader, datagridbody, datagridrow { display: block; }
+.row span { color: #f00; }
+.row.selected span { color: #0f0; }
+em { font-size: 20px; }
+</style></head><body>
+<div id="source"><p class="row" title="first"><span>One</span> <em>&lt;two&gt;</em></p><p class="row"><span style="padding-left: 2px;">Three</span></p></div>
+<datagrid id="grid" source="clone_source.rows"><col fields="name">Name</col></datagrid>
+</body></rml>)";
+
+static void TestStructure(Context* context, ElementDocument* document)
+{
+	Element* source = document->GetElementById("source");
+
+	// State changed since the element was instanced is cloned as well.
+	source->GetChild(1)->SetClass("selected", true);
+	source->GetChild(1)->SetProperty("padding-left", "7px");
+	source->GetChild(0)->RemoveProperty("padding-left");
+
+	ElementPtr clone = source->Clone();
+	TEST_CHECK(clone->GetParentNode() == nullptr);
+	TEST_CHECK(clone->GetTagName() == "div");
+	TEST_CHECK(clone->GetId() == "source");
+	TEST_CHECK(clone->GetInnerRML() == source->GetInnerRML());
+	TEST_CHECK(clone->GetNumChildren() == 2);
+	TEST_CHECK(clone->GetChild(0)->GetAttribute< String >("title", "") == "first");
+	TEST_CHECK(clone->GetChild(1)->IsClassSet("selected"));
+
+	const Property* padding = clone->GetChild(1)->GetLocalProperty("padding-left");
+	TEST_CHECK(padding && padding->Get< float >() == 7.f);
+
+	// The clone is styled like its source once it is part of the document.
+	Element* inserted = source->GetParentNode()->AppendChild(std::move(clone));
+	context->Update();
+
+	ElementList source_spans, clone_spans;
+	source->GetElementsByTagName(source_spans, "span");
+	inserted->GetElementsByTagName(clone_spans, "span");
+	TEST_CHECK(source_spans.size() == clone_spans.size());
+	for (size_t i = 0; i < source_spans.size() && i < clone_spans.size(); i++)
+	{
+		TEST_CHECK(source_spans[i]->GetProperty< Colourb >("color") == clone_spans[i]->GetProperty< Colourb >("color"));
+		TEST_CHECK(source_spans[i]->GetBox().GetSize() == clone_spans[i]->GetBox().GetSize());
+	}
+
+	// The clone is independent of its source.
+	inserted->GetChild(0)->SetClass("selected", true);
+	TEST_CHECK(!source->GetChild(0)->IsClassSet("selected"));
+
+	inserted->GetParentNode()->RemoveChild(inserted);
+}
+
+static void TestInstancerChildren(Context* context, ElementDocument* document)
+{
+	// The data grid creates its header and body when constructed, the clone must not end up with a second set.
+	Element* grid = document->GetElementById("grid");
+	const int num_grid_children = grid->GetNumChildren();
+	TEST_CHECK(num_grid_children == 2);
+
+	ElementPtr clone = grid->Clone();
+	TEST_CHECK(clone->GetNumChildren() == num_grid_children);
+	for (int i = 0; i < clone->GetNumChildren() && i < num_grid_children; i++)
+		TEST_CHECK(clone->GetChild(i)->GetTagName() == grid->GetChild(i)->GetTagName());
+
+	Element* inserted = grid->GetParentNode()->AppendChild(std::move(clone));
+	context->Update();
+	TEST_CHECK(inserted->GetNumChildren() == num_grid_children);
+
+	inserted->GetParentNode()->RemoveChild(inserted);
+}
+
+int main()
+{
+	Context* context = TestsShell::Initialise();
+
+	CloneDataSource data_source;
+
+	ElementDocument* document = TestsShell::LoadDocument(context, document_rml);
+	if (document)
+	{
+		TestStructure(context, document);
+		TestInstancerChildren(context, document);
+
+		document->Close();
+		context->Update();
+	}
+
+	TestsShell::Shutdown();
+
+	return TestsShell::Finish("ElementClone");
+}
@@ -0,0 +1,164 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TestsShell.h"
+#include <RmlUi/Controls.h>
+
+using namespace Rml::Core;
+
+class CountingListener : public EventListener
+{
+public:
+	void ProcessEvent(Event& /*event*/) override
+	{
+		num_events++;
+	}
+
+	int num_events = 0;
+};
+
+static const String document_rml = R"(<rml><head><style>
+body { display: block; width: 600px; font-family: Delicious; font-size: 16px; }
+div, p { display: block; }
+.highlight { color: #00f; }
+</style></head><body><div id="patched"/><div id="set"/></body></rml>)";
+
+static void GetElements(Element* element, ElementList& elements)
+{
+	elements.push_back(element);
+	for (int i = 0; i < element->GetNumChildren(); i++)
+		GetElements(element->GetChild(i), elements);
+}
+
+static String GetComputedState(Element* element)
+{
+	String result = element->GetTagName() + ":" + element->GetProperty("color")->ToString() + "," + element->GetProperty("width")->ToString() + ";";
+	for (int i = 0; i < element->GetNumChildren(); i++)
+		result += GetComputedState(element->GetChild(i));
+	return result;
+}
+
+static void TestEquivalence(Context* context, ElementDocument* document)
+{
+	// Patching any content over any previous content must give the same result as setting it from scratch.
+	const char* contents[] = {
+		"<p id='a' class='highlight'>One</p><p>Two <span>three</span></p>",
+		"<p>Two <span class='highlight'>three</span></p><p id='a'>One</p>",
+		"plain text &amp; more",
+		"  ",
+		"<div key='x'>x</div><div key='y' style='width: 20px;'>y</div>",
+		"<div key='y'>y</div><input type='range' min='0' max='10' value='3'/><div key='x' class='highlight'>x</div>",
+		"<select><option>a</option><option selected='selected'>b</option></select>",
+		"<p>a &lt; b</p> tail <div class='highlight' style='width: 10px;'>q</div>",
+		"",
+	};
+
+	Element* patched = document->GetElementById("patched");
+	Element* set = document->GetElementById("set");
+
+	for (const char* previous : contents)
+	{
+		for (const char* content : contents)
+		{
+			patched->SetInnerRML(previous);
+			context->Update();
+
+			patched->PatchInnerRML(content);
+			set->SetInnerRML(content);
+			context->Update();
+
+			TEST_CHECK(patched->GetInnerRML() == set->GetInnerRML());
+
+			String patched_state, set_state;
+			for (int i = 0; i < patched->GetNumChildren(); i++)
+				patched_state += GetComputedState(patched->GetChild(i));
+			for (int i = 0; i < set->GetNumChildren(); i++)
+				set_state += GetComputedState(set->GetChild(i));
+			TEST_CHECK(patched_state == set_state);
+		}
+	}
+
+	patched->SetInnerRML("");
+	set->SetInnerRML("");
+}
+
+static void TestReuse(Context* context, ElementDocument* document)
+{
+	Element* patched = document->GetElementById("patched");
+
+	const String rml = "<div key='x'>one</div><div key='y' class='highlight'>two <span>2</span></div>";
+	patched->SetInnerRML(rml);
+	context->Update();
+
+	// Patching the same content keeps every element.
+	ElementList before, after;
+	GetElements(patched, before);
+	patched->PatchInnerRML(rml);
+	GetElements(patched, after);
+	TEST_CHECK(before == after);
+
+	// Keyed children are moved rather than recreated, and their differences applied.
+	Element* x = patched->GetChild(0);
+	Element* y = patched->GetChild(1);
+
+	CountingListener listener;
+	y->AddEventListener("click", &listener);
+
+	patched->PatchInnerRML("<div key='y'>two!</div><p>new</p><div key='x'>one</div>");
+	TEST_CHECK(patched->GetNumChildren() == 3);
+	TEST_CHECK(patched->GetChild(0) == y);
+	TEST_CHECK(patched->GetChild(2) == x);
+	TEST_CHECK(!y->IsClassSet("highlight"));
+	TEST_CHECK(patched->GetInnerRML() == "<div key=\"y\">two!</div><p>new</p><div key=\"x\">one</div>");
+
+	// The event listeners of kept elements are retained.
+	y->DispatchEvent("click", Dictionary());
+	TEST_CHECK(listener.num_events == 1);
+	y->RemoveEventListener("click", &listener);
+
+	patched->SetInnerRML("");
+}
+
+int main()
+{
+	Context* context = TestsShell::Initialise();
+
+	ElementDocument* document = TestsShell::LoadDocument(context, document_rml);
+	if (document)
+	{
+		TestEquivalence(context, document);
+		TestReuse(context, document);
+
+		document->Close();
+		context->Update();
+	}
+
+	TestsShell::Shutdown();
+
+	return TestsShell::Finish("ElementPatcher");
+}
@@ -0,0 +1,179 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TestsShell.h"
+
+using namespace Rml::Core;
+
+static const String document_header = R"(<rml><head><style>
+body { display: block; width: 800px; font-family: Delicious; font-size: 16px; }
+p, div { display: block; }
+ib { display: inline-block; padding: 2px; }
+#panel { overflow-y: auto; height: 200px; width: 300px; }
+scrollbarvertical { width: 12px; }
+scrollbarvertical slidertrack { height: 100px; }
+scrollbarvertical sliderbar { height: 20px; }
+</style></head>)";
+
+// Nested inline-blocks, whose widths are shrink-to-fit and thus measured by a layout of their contents.
+static String GetNestedInlineBlocks(int depth, int breadth)
+{
+	if (depth == 0)
+		return "<span>alpha some words here</span>";
+
+	String result;
+	for (int i = 0; i < breadth; i++)
+		result += "<ib>" + GetNestedInlineBlocks(depth - 1, breadth) + "</ib> ";
+	return result;
+}
+
+static std::vector< float > GetInlineBlockBoxes(ElementDocument* document)
+{
+	std::vector< float > result;
+	ElementList elements;
+	document->GetElementsByTagName(elements, "ib");
+	for (Element* element : elements)
+	{
+		result.push_back(element->GetBox().GetSize().x);
+		result.push_back(element->GetAbsoluteLeft());
+		result.push_back(element->GetAbsoluteTop());
+	}
+	return result;
+}
+
+static void ChangeNestedContent(ElementDocument* document)
+{
+	ElementList spans;
+	document->GetElementsByTagName(spans, "span");
+	spans[37]->SetInnerRML("a much much longer replacement text that widens things");
+	spans[100]->SetProperty("font-size", "30px");
+}
+
+static void TestShrinkToFitCache(Context* context)
+{
+	const String body = GetNestedInlineBlocks(4, 4);
+
+	ElementDocument* document = TestsShell::LoadDocument(context, document_header + "<body><div id='other'/>" + body + "</body></rml>");
+	if (!document)
+		return;
+
+	// Relayout for unrelated changes, then change content deep within the nested blocks.
+	for (int i = 0; i < 3; i++)
+	{
+		document->GetElementById("other")->SetProperty("height", CreateString(32, "%dpx", 10 + i));
+		context->Update();
+	}
+
+	ChangeNestedContent(document);
+	context->Update();
+
+	// The cached widths must not survive changes to the content they were measured from.
+	ElementDocument* fresh_document = context->LoadDocumentFromMemory(document_header + "<body><div id='other' style='height: 12px;'/>" + body + "</body></rml>");
+	ChangeNestedContent(fresh_document);
+	fresh_document->Show();
+	context->Update();
+
+	TEST_CHECK(GetInlineBlockBoxes(document) == GetInlineBlockBoxes(fresh_document));
+
+	document->Close();
+	fresh_document->Close();
+	context->Update();
+}
+
+static void TestScrollbarCache(Context* context)
+{
+	String long_content;
+	for (int i = 0; i < 100; i++)
+		long_content += CreateString(128, "<p>line of text %d with a few words that wrap around the panel</p>", i);
+
+	ElementDocument* document = TestsShell::LoadDocument(context, document_header + "<body><div id='panel'>" + long_content + "</div><p id='other'>x</p></body></rml>");
+	if (!document)
+		return;
+
+	Element* panel = document->GetElementById("panel");
+	TEST_CHECK(panel->GetClientWidth() == 300.f - 12.f);
+
+	// The scrollbar decision is remembered, so unrelated changes don't restart the layout of the panel.
+	const int num_restarts = GetNumLayoutRestarts();
+	for (int i = 0; i < 5; i++)
+	{
+		document->GetElementById("other")->SetProperty("padding-top", CreateString(32, "%dpx", i % 3));
+		context->Update();
+	}
+	TEST_CHECK(GetNumLayoutRestarts() == num_restarts);
+
+	// The scrollbar goes away with the overflow, and comes back with it.
+	panel->SetInnerRML("<p>short</p>");
+	context->Update();
+	TEST_CHECK(panel->GetClientWidth() == 300.f);
+
+	panel->SetInnerRML(long_content);
+	context->Update();
+	TEST_CHECK(panel->GetClientWidth() == 300.f - 12.f);
+
+	// Content that only overflows when narrowed by the scrollbar must be laid out the same regardless of the previous
+	// layout of the panel.
+	for (int num_rows = 7; num_rows <= 10; num_rows++)
+	{
+		String content;
+		for (int i = 0; i < num_rows; i++)
+			content += "<p style='height: 20px;'></p>";
+		content += "<p><span style='display: inline-block; width: 145px; height: 20px;'></span><span style='display: inline-block; width: 145px; height: 20px;'></span></p>";
+
+		panel->SetInnerRML(long_content);
+		context->Update();
+		panel->SetInnerRML(content);
+		context->Update();
+
+		ElementDocument* fresh_document = TestsShell::LoadDocument(context, document_header + "<body><div id='panel'>" + content + "</div></body></rml>");
+		if (!fresh_document)
+			break;
+
+		Element* fresh_panel = fresh_document->GetElementById("panel");
+		TEST_CHECK(panel->GetClientWidth() == fresh_panel->GetClientWidth());
+		TEST_CHECK(panel->GetScrollHeight() == fresh_panel->GetScrollHeight());
+
+		fresh_document->Close();
+		context->Update();
+	}
+
+	document->Close();
+	context->Update();
+}
+
+int main()
+{
+	Context* context = TestsShell::Initialise();
+
+	TestShrinkToFitCache(context);
+	TestScrollbarCache(context);
+
+	TestsShell::Shutdown();
+
+	return TestsShell::Finish("LayoutCache");
+}
@@ -0,0 +1,161 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "TestsShell.h"
+#include <RmlUi/Controls.h>
+#include <chrono>
+#include <stdio.h>
+
+namespace TestsShell {
+
+static int num_failures = 0;
+
+class TestsSystemInterface : public Rml::Core::SystemInterface
+{
+public:
+	double GetElapsedTime() override
+	{
+		return std::chrono::duration< double >(std::chrono::steady_clock::now() - start_time).count();
+	}
+
+	// Errors logged by the library count as failures of the test.
+	bool LogMessage(Rml::Core::Log::Type type, const Rml::Core::String& message) override
+	{
+		if (type == Rml::Core::Log::LT_ERROR || type == Rml::Core::Log::LT_ASSERT)
+		{
+			printf("Error: %s\n", message.c_str());
+			num_failures++;
+		}
+		else if (type == Rml::Core::Log::LT_WARNING)
+			printf("Warning: %s\n", message.c_str());
+
+		return true;
+	}
+
+private:
+	std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+};
+
+class TestsRenderInterface : public Rml::Core::RenderInterface
+{
+public:
+	void RenderGeometry(Rml::Core::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, Rml::Core::TextureHandle /*texture*/, const Rml::Core::Vector2f& /*translation*/) override {}
+
+	void EnableScissorRegion(bool /*enable*/) override {}
+	void SetScissorRegion(int /*x*/, int /*y*/, int /*width*/, int /*height*/) override {}
+
+	bool LoadTexture(Rml::Core::TextureHandle& texture_handle, Rml::Core::Vector2i& texture_dimensions, const Rml::Core::String& /*source*/) override
+	{
+		texture_handle = ++num_textures;
+		texture_dimensions = Rml::Core::Vector2i(16, 16);
+		return true;
+	}
+
+	bool GenerateTexture(Rml::Core::TextureHandle& texture_handle, const Rml::Core::byte* /*source*/, const Rml::Core::Vector2i& /*source_dimensions*/) override
+	{
+		texture_handle = ++num_textures;
+		return true;
+	}
+
+	void ReleaseTexture(Rml::Core::TextureHandle /*texture_handle*/) override {}
+
+private:
+	Rml::Core::TextureHandle num_textures = 0;
+};
+
+static TestsSystemInterface* system_interface = nullptr;
+static TestsRenderInterface* render_interface = nullptr;
+
+Rml::Core::Context* Initialise()
+{
+	system_interface = new TestsSystemInterface;
+	render_interface = new TestsRenderInterface;
+
+	Rml::Core::SetSystemInterface(system_interface);
+	Rml::Core::SetRenderInterface(render_interface);
+
+	Rml::Core::Initialise();
+	Rml::Controls::Initialise();
+
+	const char* font_faces[] = { "Delicious-Roman.otf", "Delicious-Bold.otf", "Delicious-Italic.otf", "Delicious-BoldItalic.otf" };
+	for (const char* font_face : font_faces)
+		Rml::Core::LoadFontFace(Rml::Core::String(RMLUI_TESTS_ASSETS_DIR) + font_face);
+
+	return Rml::Core::CreateContext("main", Rml::Core::Vector2i(1024, 768));
+}
+
+void Shutdown()
+{
+	Rml::Core::Shutdown();
+
+	delete render_interface;
+	delete system_interface;
+	render_interface = nullptr;
+	system_interface = nullptr;
+}
+
+Rml::Core::ElementDocument* LoadDocument(Rml::Core::Context* context, const Rml::Core::String& rml)
+{
+	Rml::Core::ElementDocument* document = context->LoadDocumentFromMemory(rml);
+	if (!document)
+	{
+		Check(false, "LoadDocumentFromMemory(rml)", __FILE__, __LINE__);
+		return nullptr;
+	}
+
+	document->Show();
+	context->Update();
+
+	return document;
+}
+
+void Check(bool result, const char* expression, const char* file, int line)
+{
+	if (!result)
+	{
+		printf("%s:%d: Check failed: %s\n", file, line, expression);
+		num_failures++;
+	}
+}
+
+int GetNumFailures()
+{
+	return num_failures;
+}
+
+int Finish(const char* test_name)
+{
+	if (num_failures > 0)
+		printf("%s: %d failure(s)\n", test_name, num_failures);
+	else
+		printf("%s: passed\n", test_name);
+
+	return num_failures > 0 ? 1 : 0;
+}
+
+}
@@ -0,0 +1,64 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUITESTSSHELL_H
+#define RMLUITESTSSHELL_H
+
+#include <RmlUi/Core.h>
+
+/**
+	Shared setup of the behaviour tests. The tests run without a window, through a render interface which draws
+	nothing, and use the fonts of the samples.
+ */
+
+namespace TestsShell {
+
+/// Initialises RmlUi and the controls plugin with the test interfaces, loads the sample fonts and creates a context.
+/// @return The context to load test documents into.
+Rml::Core::Context* Initialise();
+/// Shuts down RmlUi.
+void Shutdown();
+
+/// Loads a document from RML, shows it and updates the context.
+/// @param[in] context The context to load the document into.
+/// @param[in] rml The markup of the document.
+/// @return The loaded document.
+Rml::Core::ElementDocument* LoadDocument(Rml::Core::Context* context, const Rml::Core::String& rml);
+
+/// Records the result of a check, and reports the expression if it failed.
+void Check(bool result, const char* expression, const char* file, int line);
+/// Returns the number of checks failed, and errors logged, so far.
+int GetNumFailures();
+/// Reports the result of the test, returning the exit code of the test executable.
+int Finish(const char* test_name);
+
+}
+
+#define TEST_CHECK(expression) TestsShell::Check(bool(expression), #expression, __FILE__, __LINE__)
+
+#endif